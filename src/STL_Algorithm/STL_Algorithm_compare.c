@@ -19,10 +19,76 @@ along with Sorting library. If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "../STL_Headers/STL/STL_Algorithm.h"
+#include "../STL_Headers/STL/STL_String_view.h"
 
-#include <stdlib.h>
+#include <ctype.h>
+#include <string.h>
 
 
+static double STL_numcmp_hex(const char *str)
+{
+
+    /* Reads hex digits after "0x", with an optional fraction and binary exponent, as strtod() does */
+
+    /* Initializing variables */
+    auto double value = 0.0, scale = 1.0;
+    auto int negative = 0;
+    auto long exponent = 0;
+
+    /* Main part */
+    for (; isxdigit((unsigned char) *str); ++str) {
+        value = value * 16 + ((*str <= '9') ? *str - '0' : (*str | 0x20) - 'a' + 10);
+    }
+
+    if (*str == '.') {
+        for (++str; isxdigit((unsigned char) *str); ++str) {
+            scale /= 16;
+            value += scale * ((*str <= '9') ? *str - '0' : (*str | 0x20) - 'a' + 10);
+        }
+    }
+
+    if ((*str == 'p' || *str == 'P') &&
+        (isdigit((unsigned char) str[1]) || ((str[1] == '-' || str[1] == '+') && isdigit((unsigned char) str[2])))) {
+        negative = (*++str == '-');
+        str += (*str == '-' || *str == '+');
+        for (; isdigit((unsigned char) *str) && exponent < 4096; ++str) {
+            exponent = exponent * 10 + (*str - '0');
+        }
+        for (; exponent > 0; --exponent) {
+            value = (negative) ? value / 2 : value * 2;
+        }
+    }
+
+    /* Returning value */
+    return value;
+}
+
+static double STL_numcmp_value(const char *str)
+{
+
+    /* Reads a number like atof() does, but without locale lookups: leading spaces are skipped, garbage reads as 0 */
+
+    /* Initializing variables */
+    auto STL_String_view view;
+    auto const char *digits;
+    auto double value;
+
+    /* Main part */
+    str += strspn(str, " \t\n\v\f\r");
+
+    digits = str + (*str == '-' || *str == '+');
+    if (digits[0] == '0' && (digits[1] == 'x' || digits[1] == 'X') &&
+        (isxdigit((unsigned char) digits[2]) || (digits[2] == '.' && isxdigit((unsigned char) digits[3])))) {
+        value = STL_numcmp_hex(digits + 2);
+        return (*str == '-') ? -value : value;
+    }
+
+    STL_String_view_init_str(&view, str);
+
+    /* Returning value */
+    return (STL_String_view_parse_double(&view, &value, NULL) == STL_String_OK) ? value : 0.0;
+}
+
 /* Basic functions for compare */
 int STL_numcmp(const void *num1, const void *num2)
 {
@@ -30,7 +96,7 @@ int STL_numcmp(const void *num1, const void *num2)
     /* Compares two strings numerically */
 
     /* Initializing variables */
-    auto double d1 = atof(num1), d2 = atof(num2);
+    auto double d1 = STL_numcmp_value(num1), d2 = STL_numcmp_value(num2);
 
     /* Returning value */
     return (d1 > d2) ? GREATER : (d1 < d2) ? LESS : EQUALS;
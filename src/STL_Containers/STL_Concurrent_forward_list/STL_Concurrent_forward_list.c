@@ -0,0 +1,411 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_Concurrent_forward_list.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Elements are stored right after the node, 16-byte aligned */
+static const size_t node_header = (sizeof(STL_Concurrent_forward_list_node) + 15) & ~(size_t) 15;
+
+/* Unlinked nodes are only looked over once a thread has this many, or twice the number of hazard pointers */
+static const size_t min_scan = 64;
+
+typedef STL_Concurrent_forward_list_node node_t;
+
+static node_t *STL_Concurrent_forward_list_mark(node_t *node)
+{
+
+    /* Returning value */
+    return (node_t *) ((uintptr_t) node | 1);
+}
+
+static node_t *STL_Concurrent_forward_list_unmark(node_t *node)
+{
+
+    /* Returning value */
+    return (node_t *) ((uintptr_t) node & ~(uintptr_t) 1);
+}
+
+static int STL_Concurrent_forward_list_is_marked(node_t *node)
+{
+
+    /* Returning value */
+    return (int) ((uintptr_t) node & 1);
+}
+
+static void *STL_Concurrent_forward_list_value(node_t *node)
+{
+
+    /* Returning value */
+    return (char *) node + node_header;
+}
+
+static int STL_Concurrent_forward_list_hazardous(STL_Concurrent_forward_list *self, node_t *node)
+{
+
+    /* Initializing variables */
+    register STL_Concurrent_forward_list_thread *iter;
+
+    /* Main part */
+    for (iter = __atomic_load_n(&self->threads, __ATOMIC_ACQUIRE); iter != NULL; iter = iter->next) {
+        if (__atomic_load_n(&iter->hazards[0], __ATOMIC_SEQ_CST) == node ||
+            __atomic_load_n(&iter->hazards[1], __ATOMIC_SEQ_CST) == node) {
+            return 1;
+        }
+    }
+
+    /* Returning value */
+    return 0;
+}
+
+static void STL_Concurrent_forward_list_scan(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *t)
+{
+
+    /* Frees the retired nodes of "t" that no thread holds a hazard pointer to */
+
+    /* Initializing variables */
+    register node_t *iter;
+    auto node_t *next;
+
+    /* Main part */
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+
+    iter = t->retired;
+    t->retired = NULL;
+    t->nretired = 0;
+
+    for (; iter != NULL; iter = next) {
+        next = iter->retired;
+        if (STL_Concurrent_forward_list_hazardous(self, iter)) {
+            iter->retired = t->retired;
+            t->retired = iter;
+            ++t->nretired;
+        } else {
+            free(iter);
+        }
+    }
+}
+
+static void STL_Concurrent_forward_list_retire(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *t,
+                                               node_t *node)
+{
+
+    /* Initializing variables */
+    auto size_t limit = 4 * __atomic_load_n(&self->nthreads, __ATOMIC_RELAXED);
+
+    /* Main part */
+    node->retired = t->retired;
+    t->retired = node;
+
+    if (++t->nretired >= ((limit > min_scan) ? limit : min_scan)) {
+        STL_Concurrent_forward_list_scan(self, t);
+    }
+}
+
+static void STL_Concurrent_forward_list_release(STL_Concurrent_forward_list_thread *t)
+{
+
+    /* Main part */
+    __atomic_store_n(&t->hazards[0], NULL, __ATOMIC_RELEASE);
+    __atomic_store_n(&t->hazards[1], NULL, __ATOMIC_RELEASE);
+}
+
+static int STL_Concurrent_forward_list_find(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *t,
+                                            const void *elem, node_t ***prev, node_t **cur, node_t **next)
+{
+
+    /* Leaves "*cur" at the first element not less than "elem", and "*prev" at the link to it. Both are protected.
+     * Marked nodes on the way are unlinked and retired */
+
+    /* Initializing variables */
+    auto node_t *expected;
+    auto int diff;
+
+    /* Main part */
+    for (;;) {
+        *prev = &self->head;
+        *cur = __atomic_load_n(*prev, __ATOMIC_ACQUIRE);
+
+        for (;;) {
+            if (*cur == NULL) {
+                return 0;
+            }
+
+            /* Unless the link still points to "*cur" once the hazard pointer is visible, it may be freed already */
+            __atomic_store_n(&t->hazards[0], *cur, __ATOMIC_SEQ_CST);
+            if (__atomic_load_n(*prev, __ATOMIC_SEQ_CST) != *cur) {
+                break;
+            }
+
+            *next = __atomic_load_n(&(*cur)->next, __ATOMIC_ACQUIRE);
+            if (STL_Concurrent_forward_list_is_marked(*next)) {
+                expected = *cur;
+                *next = STL_Concurrent_forward_list_unmark(*next);
+                if (!__atomic_compare_exchange_n(*prev, &expected, *next, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                    break;
+                }
+
+                STL_Concurrent_forward_list_retire(self, t, *cur);
+                *cur = *next;
+                continue;
+            }
+
+            if ((diff = self->cmp(STL_Concurrent_forward_list_value(*cur), elem)) >= 0) {
+                return diff == 0;
+            }
+
+            /* "*cur" becomes the predecessor. It is still held by the other hazard pointer until this one is taken */
+            __atomic_store_n(&t->hazards[1], *cur, __ATOMIC_SEQ_CST);
+            *prev = &(*cur)->next;
+            *cur = *next;
+        }
+    }
+}
+
+int STL_Concurrent_forward_list_init(STL_Concurrent_forward_list *self, size_t nbytes,
+                                     int (*cmp)(const void *, const void *))
+{
+
+    /* VarCheck */
+    if (self == NULL || cmp == NULL) {
+        return STL_Concurrent_forward_list_null_reference_error;
+    }
+
+    if (!nbytes || nbytes > (size_t) -1 - node_header) {
+        return STL_Concurrent_forward_list_index_error;
+    }
+
+    /* Main part */
+    self->head = NULL;
+    self->threads = NULL;
+    self->nbytes = nbytes;
+    self->nelem = 0;
+    self->nthreads = 0;
+    self->cmp = cmp;
+
+    /* Returning value */
+    return STL_Concurrent_forward_list_OK;
+}
+
+void STL_Concurrent_forward_list_delete(STL_Concurrent_forward_list *self)
+{
+
+    /* Initializing variables */
+    auto STL_Concurrent_forward_list_thread *thread, *next_thread;
+    auto node_t *iter, *next;
+
+    /* Main part */
+    if (self == NULL) {
+        return;
+    }
+
+    /* Nodes still in the list were never retired, and retired ones are never in the list */
+    for (iter = STL_Concurrent_forward_list_unmark(self->head); iter != NULL; iter = next) {
+        next = STL_Concurrent_forward_list_unmark(iter->next);
+        free(iter);
+    }
+
+    for (thread = self->threads; thread != NULL; thread = next_thread) {
+        next_thread = thread->next;
+        for (iter = thread->retired; iter != NULL; iter = next) {
+            next = iter->retired;
+            free(iter);
+        }
+        free(thread);
+    }
+
+    STL_Concurrent_forward_list_init(self, self->nbytes, self->cmp);
+}
+
+STL_Concurrent_forward_list_thread *STL_Concurrent_forward_list_attach(STL_Concurrent_forward_list *self)
+{
+
+    /* Initializing variables */
+    auto STL_Concurrent_forward_list_thread *thread;
+    auto int expected;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return NULL;
+    }
+
+    /* Main part */
+    for (thread = __atomic_load_n(&self->threads, __ATOMIC_ACQUIRE); thread != NULL; thread = thread->next) {
+        expected = 0;
+        if (!__atomic_load_n(&thread->active, __ATOMIC_RELAXED) &&
+            __atomic_compare_exchange_n(&thread->active, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED)) {
+            return thread;
+        }
+    }
+
+    if ((thread = malloc(sizeof(STL_Concurrent_forward_list_thread))) == NULL) {
+        return NULL;
+    }
+
+    thread->hazards[0] = thread->hazards[1] = NULL;
+    thread->retired = NULL;
+    thread->nretired = 0;
+    thread->active = 1;
+
+    thread->next = __atomic_load_n(&self->threads, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&self->threads, &thread->next, thread, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED))
+        ;
+    __atomic_add_fetch(&self->nthreads, 1, __ATOMIC_RELAXED);
+
+    /* Returning value */
+    return thread;
+}
+
+void STL_Concurrent_forward_list_detach(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *thread)
+{
+
+    /* Main part */
+    if (self == NULL || thread == NULL) {
+        return;
+    }
+
+    /* Retired nodes stay with the record: whoever takes it next frees them */
+    STL_Concurrent_forward_list_release(thread);
+    __atomic_store_n(&thread->active, 0, __ATOMIC_RELEASE);
+}
+
+int STL_Concurrent_forward_list_empty(STL_Concurrent_forward_list *self)
+{
+
+    /* Returning value */
+    return (self == NULL || __atomic_load_n(&self->head, __ATOMIC_ACQUIRE) == NULL) ? concurrent_forward_list_is_empty
+                                                                                   : concurrent_forward_list_not_empty;
+}
+
+size_t STL_Concurrent_forward_list_size(STL_Concurrent_forward_list *self)
+{
+
+    /* Returning value */
+    return (self != NULL) ? __atomic_load_n(&self->nelem, __ATOMIC_RELAXED) : 0;
+}
+
+int STL_Concurrent_forward_list_insert(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *thread,
+                                       const void *elem)
+{
+
+    /* Initializing variables */
+    auto node_t **prev, *cur, *next, *node;
+    auto int code;
+
+    /* VarCheck */
+    if (self == NULL || thread == NULL || elem == NULL) {
+        return STL_Concurrent_forward_list_null_reference_error;
+    }
+
+    /* Main part */
+    if ((node = malloc(node_header + self->nbytes)) == NULL) {
+        return STL_Concurrent_forward_list_memory_error;
+    }
+    memcpy(STL_Concurrent_forward_list_value(node), elem, self->nbytes);
+    node->retired = NULL;
+
+    for (;;) {
+        if (STL_Concurrent_forward_list_find(self, thread, elem, &prev, &cur, &next)) {
+            free(node);
+            code = STL_Concurrent_forward_list_key_error;
+            break;
+        }
+
+        node->next = cur;
+        if (__atomic_compare_exchange_n(prev, &cur, node, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED)) {
+            __atomic_add_fetch(&self->nelem, 1, __ATOMIC_RELAXED);
+            code = STL_Concurrent_forward_list_OK;
+            break;
+        }
+    }
+
+    STL_Concurrent_forward_list_release(thread);
+
+    /* Returning value */
+    return code;
+}
+
+int STL_Concurrent_forward_list_erase(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *thread,
+                                      const void *elem)
+{
+
+    /* Initializing variables */
+    auto node_t **prev, *cur, *next, *expected;
+    auto int code;
+
+    /* VarCheck */
+    if (self == NULL || thread == NULL || elem == NULL) {
+        return STL_Concurrent_forward_list_null_reference_error;
+    }
+
+    /* Main part */
+    for (;;) {
+        if (!STL_Concurrent_forward_list_find(self, thread, elem, &prev, &cur, &next)) {
+            code = STL_Concurrent_forward_list_key_error;
+            break;
+        }
+
+        /* Marking the link out of the node is what erases it. Whoever wins this owns the erasure */
+        if (!__atomic_compare_exchange_n(&cur->next, &next, STL_Concurrent_forward_list_mark(next), 0,
+                                         __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            continue;
+        }
+
+        expected = cur;
+        if (__atomic_compare_exchange_n(prev, &expected, next, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)) {
+            STL_Concurrent_forward_list_retire(self, thread, cur);
+        } else {
+            STL_Concurrent_forward_list_find(self, thread, elem, &prev, &cur, &next);
+        }
+
+        __atomic_sub_fetch(&self->nelem, 1, __ATOMIC_RELAXED);
+        code = STL_Concurrent_forward_list_OK;
+        break;
+    }
+
+    STL_Concurrent_forward_list_release(thread);
+
+    /* Returning value */
+    return code;
+}
+
+int STL_Concurrent_forward_list_contains(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *thread,
+                                         const void *elem)
+{
+
+    /* Initializing variables */
+    auto node_t **prev, *cur, *next;
+    auto int found;
+
+    /* VarCheck */
+    if (self == NULL || thread == NULL || elem == NULL) {
+        return 0;
+    }
+
+    /* Main part */
+    found = STL_Concurrent_forward_list_find(self, thread, elem, &prev, &cur, &next);
+    STL_Concurrent_forward_list_release(thread);
+
+    /* Returning value */
+    return found;
+}
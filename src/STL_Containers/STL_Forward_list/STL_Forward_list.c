@@ -23,6 +23,34 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 #include <stdlib.h>
 #include <string.h>
 
+/* Elements are stored right after the node, 16-byte aligned */
+static const size_t node_header = (sizeof(STL_Forward_list_node) + 15) & ~(size_t) 15;
+
+static STL_Forward_list_node *STL_Forward_list_new_node(STL_Forward_list *l, const void *elem, size_t size)
+{
+
+    /* Initializing variables */
+    auto STL_Forward_list_node *node;
+
+    /* Main part */
+    if ((node = __STL_Pool_alloc(&l->pool, node_header + size)) == NULL) {
+        return NULL;
+    }
+
+    node->value = (char *) node + node_header;
+    node->size = size;
+    memcpy(node->value, elem, size);
+
+    /* Returning value */
+    return node;
+}
+
+static void STL_Forward_list_free_node(STL_Forward_list *l, STL_Forward_list_node *node)
+{
+
+    /* Main part */
+    __STL_Pool_free(&l->pool, node, node_header + node->size);
+}
 
 static void STL_Forward_list_check_pointers(STL_Forward_list *l)
 {
@@ -33,6 +61,41 @@ static void STL_Forward_list_check_pointers(STL_Forward_list *l)
     }
 }
 
+static STL_Forward_list_node *STL_Forward_list_merge_chains(STL_Forward_list_node *a, STL_Forward_list_node *a_end,
+                                                            STL_Forward_list_node *b, STL_Forward_list_node *b_end,
+                                                            int (*cmp)(const void *, const void *))
+{
+
+    /* Merges two sorted chains. The result ends at "a_end". Nodes of "a" go first among equal ones */
+
+    /* Initializing variables */
+    auto STL_Forward_list_node head, *tail = &head;
+
+    /* Main part */
+    while (a != a_end && b != b_end) {
+        if (cmp(b->value, a->value) < 0) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+
+    if (a != a_end || b == b_end) {
+        tail->next = a;
+    } else {
+        /* What's left of "b" has to be re-terminated */
+        for (tail->next = b; b->next != b_end; b = b->next)
+            ;
+        b->next = a_end;
+    }
+
+    /* Returning value */
+    return head.next;
+}
+
 int STL_Forward_list_init(STL_Forward_list *l)
 {
 
@@ -46,13 +109,17 @@ int STL_Forward_list_init(STL_Forward_list *l)
     }
 
     if ((l->lp = l->bp->next = malloc(sizeof(STL_Forward_list_node))) == NULL) {
+        free(l->bp);
         return STL_Forward_list_memory_error;
     }
 
     l->size = 0;
 
     l->bp->value = l->lp->value = NULL;
-    l->bp->size = 0;
+    l->bp->size = l->lp->size = 0;
+    l->lp->next = NULL;
+
+    __STL_Pool_init(&l->pool);
 
     /* Returning value */
     return STL_Forward_list_OK;
@@ -63,19 +130,34 @@ int STL_Forward_list_init_cpy(STL_Forward_list *self, STL_Forward_list *other)
 
     /* Initializing variables */
     register STL_Forward_list_node *iter;
+    auto STL_Forward_list_node *node, *last;
     auto int code;
 
     /* Main part */
     code = STL_Forward_list_init(self);
-    if (other == NULL || code != STL_Forward_list_OK) {
+    if (other == NULL || code != STL_Forward_list_OK || STL_Forward_list_empty(other)) {
         return code;
     }
 
-    for (iter = STL_Forward_list_begin(other); iter != STL_Forward_list_end(other); iter = iter->next) {
-        STL_Forward_list_push_front(self, iter->value, iter->size);
+    /* One pass: nodes are copied whole and linked in order, the pool pre-sized for the size of the first one */
+    STL_Forward_list_reserve(self, other->size, STL_Forward_list_begin(other)->size);
+    for (last = self->bp, iter = STL_Forward_list_begin(other); iter != STL_Forward_list_end(other);
+         iter = iter->next) {
+        if ((node = STL_Forward_list_new_node(self, iter->value, iter->size)) == NULL) {
+            break;
+        }
+
+        last->next = node;
+        last = node;
+        ++self->size;
     }
 
-    STL_Forward_list_reverse(self);
+    last->next = self->lp;
+
+    if (iter != STL_Forward_list_end(other)) {
+        STL_Forward_list_delete(self);
+        return STL_Forward_list_memory_error;
+    }
 
     /* Returning value */
     return STL_Forward_list_OK;
@@ -91,6 +173,7 @@ void STL_Forward_list_delete(STL_Forward_list *l)
 
     STL_Forward_list_clear(l);
 
+    free(l->lp);
     free(l->bp);
 }
 
@@ -160,16 +243,131 @@ size_t STL_Forward_list_size(STL_Forward_list *l)
 void STL_Forward_list_clear(STL_Forward_list *l)
 {
 
+    /* Initializing variables */
+    register STL_Forward_list_node *iter, *next;
+
     /* Main part */
     if (l == NULL) {
         return;
     }
 
-    while (l->size) {
-        STL_Forward_list_pop_front(l);
+    /* Nodes too big for the slabs, or maybe living in slabs of other lists, are freed one by one. The rest goes with the slabs */
+    if (l->pool.nlarge || l->pool.home != NULL) {
+        for (iter = STL_Forward_list_begin(l); iter != STL_Forward_list_end(l); iter = next) {
+            next = iter->next;
+            STL_Forward_list_free_node(l, iter);
+        }
     }
 
-    STL_Forward_list_check_pointers(l);
+    __STL_Pool_release(&l->pool);
+
+    l->bp->next = l->lp;
+    l->size = 0;
+}
+
+int STL_Forward_list_reserve(STL_Forward_list *l, size_t n, size_t size)
+{
+
+    /* VarCheck */
+    if (l == NULL) {
+        return STL_Forward_list_null_reference_error;
+    }
+
+    /* Main part */
+    if (!__STL_Pool_reserve(&l->pool, node_header + size, n)) {
+        return STL_Forward_list_memory_error;
+    }
+
+    /* Returning value */
+    return STL_Forward_list_OK;
+}
+
+int STL_Forward_list_compact(STL_Forward_list *l)
+{
+
+    /* Initializing variables */
+    register STL_Forward_list_node *iter;
+    auto STL_Forward_list_node *node, *last, *next;
+    auto size_t nbytes = 0;
+    auto __STL_Pool pool;
+
+    /* VarCheck */
+    if (l == NULL) {
+        return STL_Forward_list_null_reference_error;
+    }
+
+    /* Main part */
+    for (iter = STL_Forward_list_begin(l); iter != STL_Forward_list_end(l); iter = iter->next) {
+        nbytes += __STL_Pool_block_size(node_header + iter->size);
+    }
+
+    /* The run is allocated up front, so the list is left as it was if memory runs out */
+    __STL_Pool_init(&pool);
+    if (nbytes && !__STL_Pool_run(&pool, nbytes)) {
+        return STL_Forward_list_memory_error;
+    }
+
+    /* Nodes are laid out in traversal order. Large ones already have a malloc() block each */
+    for (last = l->bp, iter = STL_Forward_list_begin(l); iter != STL_Forward_list_end(l); iter = next) {
+        next = iter->next;
+        if (__STL_Pool_block_size(node_header + iter->size) != 0) {
+            node = __STL_Pool_run_alloc(&pool, node_header + iter->size);
+            memcpy(node, iter, node_header + iter->size);
+            node->value = (char *) node + node_header;
+
+            /* Old nodes of a shared pool have to be handed back before it is released */
+            if (l->pool.home != NULL) {
+                __STL_Pool_free(&l->pool, iter, node_header + node->size);
+            }
+        } else {
+            node = iter;
+        }
+
+        last->next = node;
+        last = node;
+    }
+
+    last->next = l->lp;
+
+    pool.nlarge = l->pool.nlarge;
+    __STL_Pool_release(&l->pool);
+    l->pool = pool;
+
+    /* Returning value */
+    return STL_Forward_list_OK;
+}
+
+double STL_Forward_list_fragmentation(STL_Forward_list *l)
+{
+
+    /* Initializing variables */
+    register STL_Forward_list_node *iter;
+    auto STL_Forward_list_node *prev = NULL;
+    auto size_t nlinks = 0, nscattered = 0;
+
+    /* VarCheck */
+    if (l == NULL) {
+        return 0.0;
+    }
+
+    /* Main part */
+    for (iter = STL_Forward_list_begin(l); iter != STL_Forward_list_end(l); iter = iter->next) {
+        if (__STL_Pool_block_size(node_header + iter->size) == 0) {
+            continue;
+        }
+
+        /* Large nodes are skipped: they are never moved anyway */
+        if (prev != NULL) {
+            ++nlinks;
+            if (!__STL_Pool_adjacent(prev, node_header + prev->size, iter)) {
+                ++nscattered;
+            }
+        }
+        prev = iter;
+    }
+
+    /* Returning value */
+    return (nlinks) ? (double) nscattered / (double) nlinks : 0.0;
 }
 
 int STL_Forward_list_insert_after(STL_Forward_list *l, const void *elem, size_t size, STL_Forward_list_node *pos)
@@ -184,16 +382,10 @@ int STL_Forward_list_insert_after(STL_Forward_list *l, const void *elem, size_t
     }
 
     /* Inserting element */
-    if ((new_element = (STL_Forward_list_node *) calloc(1, sizeof(STL_Forward_list_node))) == NULL) {
-        return STL_Forward_list_memory_error;
-    }
-    if ((new_element->value = malloc(size)) == NULL) {
+    if ((new_element = STL_Forward_list_new_node(l, elem, size)) == NULL) {
         return STL_Forward_list_memory_error;
     }
 
-    memcpy(new_element->value, elem, size);
-    new_element->size = size;
-
     if (pos != NULL) {
         new_element->next = pos->next;
         pos->next = new_element;
@@ -207,7 +399,7 @@ int STL_Forward_list_insert_after(STL_Forward_list *l, const void *elem, size_t
 
         ++l->size;
     } else {
-        free(new_element);
+        STL_Forward_list_free_node(l, new_element);
     }
 
 
@@ -219,29 +411,27 @@ STL_Forward_list_node *STL_Forward_list_erase_after(STL_Forward_list *l, STL_For
 {
 
     /* Initializing variables */
-    auto STL_Forward_list_node *ret;
+    auto STL_Forward_list_node *victim;
 
     /* Main part */
     if (l == NULL || pos == NULL || STL_Forward_list_empty(l)) {
         return NULL;
     }
 
-    pos->next = pos->next->next;
-
-    free(pos->next->value);
-    if (pos->next == NULL) {
-        ret = STL_Forward_list_end(l);
-    } else {
-        ret = pos->next->next;
+    victim = pos->next;
+    if (victim == NULL || victim == STL_Forward_list_end(l)) {
+        return NULL;
     }
-    free(pos->next);
+
+    pos->next = victim->next;
+    STL_Forward_list_free_node(l, victim);
 
     --l->size;
 
     STL_Forward_list_check_pointers(l);
 
     /* Returning value */
-    return ret;
+    return pos->next;
 }
 
 int STL_Forward_list_push_front(STL_Forward_list *l, const void *elem, size_t size)
@@ -259,87 +449,337 @@ STL_Forward_list_node *STL_Forward_list_pop_front(STL_Forward_list *l)
 }
 
 void STL_Forward_list_merge(STL_Forward_list *self, STL_Forward_list *other, int (*cmp)(const void *, const void *))
+{
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || self == other || cmp == NULL || STL_Forward_list_empty(other)) {
+        return;
+    }
+
+    /* Main part */
+    /* The nodes of "other" move over together with the slabs they live in */
+    self->bp->next = STL_Forward_list_merge_chains(STL_Forward_list_begin(self), STL_Forward_list_end(self),
+                                                   STL_Forward_list_begin(other), STL_Forward_list_end(other), cmp);
+    self->size += other->size;
+
+    __STL_Pool_adopt(&self->pool, &other->pool);
+    other->bp->next = other->lp;
+    other->size = 0;
+}
+
+int STL_Forward_list_splice_after(STL_Forward_list *self, STL_Forward_list_node *pos, STL_Forward_list *other)
 {
 
     /* Initializing variables */
-    auto STL_Forward_list_node *i1 = STL_Forward_list_before_begin(self), *i2;
+    auto STL_Forward_list_node *last;
 
     /* VarCheck */
-    if (self == NULL || other == NULL || STL_Forward_list_empty(other)) {
-        return;
+    if (self == NULL || other == NULL || pos == NULL) {
+        return STL_Forward_list_null_reference_error;
+    }
+
+    if (pos->next == NULL) {
+        return STL_Forward_list_index_error;
     }
 
     /* Main part */
-    if (!STL_Forward_list_empty(self)) {
-        for (i1 = STL_Forward_list_before_begin(self), i2 = STL_Forward_list_before_begin(other);
-             i1->next != STL_Forward_list_end(self) && i2->next != STL_Forward_list_end(other); ) {
-            if (cmp(i1->next->value, i2->value) < 0) {
-                i1 = i1->next;
-            } else {
-                STL_Forward_list_insert_after(self, i2->value, i2->size, i1);
-                i2 = STL_Forward_list_erase_after(other, i2);
-            };
+    if (self == other || STL_Forward_list_empty(other)) {
+        return STL_Forward_list_OK;
+    }
+
+    /* The nodes of "other" move over together with the slabs they live in */
+    for (last = STL_Forward_list_begin(other); last->next != STL_Forward_list_end(other); last = last->next)
+        ;
+    last->next = pos->next;
+    pos->next = STL_Forward_list_begin(other);
+    other->bp->next = other->lp;
+
+    self->size += other->size;
+    other->size = 0;
+    __STL_Pool_adopt(&self->pool, &other->pool);
+
+    /* Returning value */
+    return STL_Forward_list_OK;
+}
+
+int STL_Forward_list_splice_after_node(STL_Forward_list *self, STL_Forward_list_node *pos, STL_Forward_list *other,
+                                       STL_Forward_list_node *before)
+{
+
+    /* Initializing variables */
+    auto STL_Forward_list_node *node;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL || before == NULL) {
+        return STL_Forward_list_null_reference_error;
+    }
+
+    node = before->next;
+    if (pos->next == NULL || node == NULL || node == STL_Forward_list_end(other)) {
+        return STL_Forward_list_index_error;
+    }
+
+    /* Main part */
+    if (pos == before || pos == node) {
+        return STL_Forward_list_OK;
+    }
+
+    /* A moved node goes back to the slab it lives in when freed, and keeps that slab alive until then */
+    if (self != other) {
+        if (!__STL_Pool_share(&self->pool, &other->pool)) {
+            return STL_Forward_list_memory_error;
+        }
+        __STL_Pool_move(&self->pool, &other->pool, node_header + node->size);
+
+        ++self->size;
+        --other->size;
+    }
+
+    before->next = node->next;
+    node->next = pos->next;
+    pos->next = node;
+
+    /* Returning value */
+    return STL_Forward_list_OK;
+}
+
+int STL_Forward_list_splice_after_range(STL_Forward_list *self, STL_Forward_list_node *pos, STL_Forward_list *other,
+                                        STL_Forward_list_node *first, STL_Forward_list_node *last)
+{
+
+    /* Initializing variables */
+    register STL_Forward_list_node *iter;
+    auto STL_Forward_list_node *tail;
+    register size_t n;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL || first == NULL || last == NULL) {
+        return STL_Forward_list_null_reference_error;
+    }
+
+    if (pos->next == NULL) {
+        return STL_Forward_list_index_error;
+    }
+
+    /* Main part */
+    if (first == last || first->next == last) {
+        return STL_Forward_list_OK;
+    }
+
+    for (tail = first, n = 0; tail->next != last; tail = tail->next, ++n) {
+        if (tail->next == STL_Forward_list_end(other)) {
+            return STL_Forward_list_index_error;
         }
+    }
 
-        if (!STL_Forward_list_empty(other)) {
-            goto case_2;
+    if (self != other) {
+        if (!__STL_Pool_share(&self->pool, &other->pool)) {
+            return STL_Forward_list_memory_error;
         }
-    } else {
-        case_2:
-        for (i2 = STL_Forward_list_before_begin(other);
-             i2->next != STL_Forward_list_end(other);
-             i2 = STL_Forward_list_erase_after(other, i2)) {
-            STL_Forward_list_insert_after(self, i2->next->value, i2->next->size, i1);
-            i1 = i1->next;
+        if (other->pool.nlarge) {
+            for (iter = first->next; iter != last; iter = iter->next) {
+                __STL_Pool_move(&self->pool, &other->pool, node_header + iter->size);
+            }
         }
+
+        self->size += n;
+        other->size -= n;
     }
 
+    iter = first->next;
+    first->next = last;
+    tail->next = pos->next;
+    pos->next = iter;
+
+    /* Returning value */
+    return STL_Forward_list_OK;
 }
 
-void STL_Forward_list_reverse(STL_Forward_list *self)
+size_t STL_Forward_list_remove_if(STL_Forward_list *l, int (*pred)(const void *, void *), void *arg)
 {
 
     /* Initializing variables */
-    auto STL_Forward_list_node *iter, *iter_2;
-    auto STL_Forward_list other;
-    STL_Forward_list_init(&other);
+    register STL_Forward_list_node *prev, *iter;
+    auto size_t n = 0;
+
+    /* VarCheck */
+    if (l == NULL || pred == NULL) {
+        return 0;
+    }
 
     /* Main part */
-    for (iter = STL_Forward_list_begin(self); iter != STL_Forward_list_end(self); iter = iter->next) {
-        STL_Forward_list_push_front(&other, iter->value, iter->size);
+    for (prev = STL_Forward_list_before_begin(l); (iter = prev->next) != STL_Forward_list_end(l);) {
+        if (pred(iter->value, arg)) {
+            prev->next = iter->next;
+            STL_Forward_list_free_node(l, iter);
+            ++n;
+        } else {
+            prev = iter;
+        }
     }
 
-    for (iter = STL_Forward_list_begin(self), iter_2 = STL_Forward_list_begin(&other);
-         iter != STL_Forward_list_end(self);
-         iter = iter->next, iter_2 = iter_2->next) {
-        STL_Forward_list_swap_nodes(iter, iter_2);
+    l->size -= n;
+
+    /* Returning value */
+    return n;
+}
+
+size_t STL_Forward_list_unique(STL_Forward_list *l, int (*cmp)(const void *, const void *))
+{
+
+    /* Initializing variables */
+    register STL_Forward_list_node *iter, *next;
+    auto size_t n = 0;
+
+    /* VarCheck */
+    if (l == NULL || cmp == NULL || STL_Forward_list_empty(l)) {
+        return 0;
     }
 
-    STL_Forward_list_delete(&other);
+    /* Main part */
+    /* Every element is compared with the first one of its group, which is kept */
+    for (iter = STL_Forward_list_begin(l); (next = iter->next) != STL_Forward_list_end(l);) {
+        if (!cmp(iter->value, next->value)) {
+            iter->next = next->next;
+            STL_Forward_list_free_node(l, next);
+            ++n;
+        } else {
+            iter = next;
+        }
+    }
+
+    l->size -= n;
+
+    /* Returning value */
+    return n;
 }
 
-void STL_Forward_list_sort(STL_Forward_list *l, size_t n, int (*cmp)(const void *, const void *))
+STL_Forward_list_node *STL_Forward_list_partition(STL_Forward_list *l, int (*pred)(const void *, void *), void *arg)
 {
 
     /* Initializing variables */
+    register STL_Forward_list_node *prev, *iter;
+    auto STL_Forward_list_node head, *tail = &head;
+
+    /* VarCheck */
+    if (l == NULL || pred == NULL) {
+        return NULL;
+    }
+
+    /* Main part */
+    /* Nodes that fail "pred" are collected in order and put back at the end */
+    for (prev = STL_Forward_list_before_begin(l); (iter = prev->next) != STL_Forward_list_end(l);) {
+        if (!pred(iter->value, arg)) {
+            prev->next = iter->next;
+            tail->next = iter;
+            tail = iter;
+        } else {
+            prev = iter;
+        }
+    }
+
+    tail->next = STL_Forward_list_end(l);
+    prev->next = (tail != &head) ? head.next : STL_Forward_list_end(l);
 
+    /* Returning value */
+    return prev->next;
 }
 
-void STL_Forward_list_swap_nodes(STL_Forward_list_node *a, STL_Forward_list_node *b)
+void STL_Forward_list_reverse(STL_Forward_list *self)
 {
 
     /* Initializing variables */
-    auto STL_Forward_list_node tmp;
+    auto STL_Forward_list_node *iter, *prev, *next;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
 
     /* Main part */
-    tmp.value = b->value;
-    tmp.size = b->size;
+    /* Relinked in place: the values stay in the pool of this list */
+    for (prev = STL_Forward_list_end(self), iter = STL_Forward_list_begin(self); iter != STL_Forward_list_end(self);
+         iter = next) {
+        next = iter->next;
+        iter->next = prev;
+        prev = iter;
+    }
+
+    self->bp->next = prev;
+}
+
+void STL_Forward_list_sort(STL_Forward_list *l, size_t n, int (*cmp)(const void *, const void *))
+{
 
-    b->value = a->value;
-    b->size = a->size;
+    /* Initializing variables */
+    auto STL_Forward_list_node *bins[sizeof(size_t) * 8], *chain, *node, *rest;
+    register size_t i;
 
-    a->value = tmp.value;
-    a->size = tmp.size;
+    /* VarCheck */
+    if (l == NULL || cmp == NULL) {
+        return;
+    }
+
+    /* Main part */
+    n = (n < l->size) ? n : l->size;
+    if (n < 2) {
+        return;
+    }
+
+    /* Every chain below ends at "rest", the first node that isn't sorted */
+    for (i = 0, rest = STL_Forward_list_begin(l); i < n; ++i) {
+        rest = rest->next;
+    }
+
+    /* Bottom-up: bins[i] holds a sorted run of 2^i nodes, each one older than everything in lower bins */
+    memset(bins, 0, sizeof(bins));
+    for (chain = STL_Forward_list_begin(l); chain != rest;) {
+        node = chain;
+        chain = chain->next;
+        node->next = rest;
+
+        for (i = 0; bins[i] != NULL; ++i) {
+            node = STL_Forward_list_merge_chains(bins[i], rest, node, rest, cmp);
+            bins[i] = NULL;
+        }
+        bins[i] = node;
+    }
+
+    for (i = 0, node = NULL; i < sizeof(bins) / sizeof(*bins); ++i) {
+        if (bins[i] != NULL) {
+            node = (node == NULL) ? bins[i] : STL_Forward_list_merge_chains(bins[i], rest, node, rest, cmp);
+        }
+    }
+
+    l->bp->next = node;
+}
+
+int STL_Forward_list_swap_nodes(STL_Forward_list_node *a, STL_Forward_list_node *b)
+{
+
+    /* Initializing variables */
+    auto unsigned char *pa, *pb, tmp;
+    register size_t i;
+
+    /* VarCheck */
+    if (a == NULL || b == NULL || a->value == NULL || b->value == NULL) {
+        return STL_Forward_list_null_reference_error;
+    }
+
+    /* Elements live inside their nodes, so only ones of the same size can trade places */
+    if (a->size != b->size) {
+        return STL_Forward_list_index_error;
+    }
+
+    /* Main part */
+    for (i = 0, pa = a->value, pb = b->value; i < a->size; ++i) {
+        tmp = pa[i];
+        pa[i] = pb[i];
+        pb[i] = tmp;
+    }
+
+    /* Returning value */
+    return STL_Forward_list_OK;
 }
 
 void STL_Forward_list_swap(STL_Forward_list *self, STL_Forward_list *other)
@@ -352,14 +792,17 @@ void STL_Forward_list_swap(STL_Forward_list *self, STL_Forward_list *other)
     tmp.bp = other->bp;
     tmp.lp = other->lp;
     tmp.size = other->size;
+    tmp.pool = other->pool;
 
     other->bp = self->bp;
     other->lp = self->lp;
     other->size = self->size;
+    other->pool = self->pool;
 
     self->bp = tmp.bp;
     self->lp = tmp.lp;
     self->size = tmp.size;
+    self->pool = tmp.pool;
 }
 
 size_t STL_Forward_list_size_node(STL_Forward_list_node *node)
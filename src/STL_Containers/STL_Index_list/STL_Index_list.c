@@ -0,0 +1,499 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_Index_list.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Unused slots have this in place of "prev". No slot can have it as an index */
+static const uint32_t free_mark = (uint32_t) -1;
+
+static const size_t first_capacity = 16;
+
+static STL_Index_list_links *STL_Index_list_links_at(const STL_Index_list *self, uint32_t i)
+{
+
+    /* Returning value */
+    return (STL_Index_list_links *) ((char *) self->slots + i * self->stride);
+}
+
+static void STL_Index_list_free_slots(STL_Index_list *self, size_t from)
+{
+
+    /* Chains slots from "from" up to the end of the array in front of the unused ones, lowest first */
+
+    /* Initializing variables */
+    auto STL_Index_list_links *links;
+    register size_t i;
+
+    /* Main part */
+    for (i = self->capacity; i-- > from;) {
+        links = STL_Index_list_links_at(self, (uint32_t) i);
+        links->next = self->free;
+        links->prev = free_mark;
+        self->free = (uint32_t) i;
+    }
+}
+
+static int STL_Index_list_grow(STL_Index_list *self, size_t capacity)
+{
+
+    /* Initializing variables */
+    auto void *slots;
+    auto size_t old_capacity = self->capacity;
+
+    /* Main part */
+    if (capacity > (size_t) free_mark || capacity > (size_t) -1 / self->stride) {
+        return 0;
+    }
+
+    if ((slots = realloc(self->slots, capacity * self->stride)) == NULL) {
+        return 0;
+    }
+
+    self->slots = slots;
+    self->capacity = capacity;
+
+    if (!old_capacity) {
+        STL_Index_list_links_at(self, 0)->next = STL_Index_list_links_at(self, 0)->prev = 0;
+        old_capacity = 1;
+    }
+    STL_Index_list_free_slots(self, old_capacity);
+
+    /* Returning value */
+    return 1;
+}
+
+static int STL_Index_list_valid(const STL_Index_list *self, uint32_t i)
+{
+
+    /* Returning value */
+    return i != 0 && i < self->capacity && STL_Index_list_links_at(self, i)->prev != free_mark;
+}
+
+int STL_Index_list_init(STL_Index_list *self, size_t nbytes)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_Index_list_null_reference_error;
+    }
+
+    if (!nbytes || nbytes > (size_t) -1 - sizeof(STL_Index_list_links) - 7) {
+        return STL_Index_list_index_error;
+    }
+
+    /* Main part */
+    self->slots = NULL;
+    self->nbytes = nbytes;
+    self->stride = (sizeof(STL_Index_list_links) + nbytes + 7) & ~(size_t) 7;
+    self->nelem = 0;
+    self->capacity = 0;
+    self->free = 0;
+
+    /* Returning value */
+    return STL_Index_list_OK;
+}
+
+int STL_Index_list_init_cpy(STL_Index_list *self, STL_Index_list *other)
+{
+
+    /* VarCheck */
+    if (self == NULL || other == NULL) {
+        return STL_Index_list_null_reference_error;
+    }
+
+    /* Main part */
+    *self = *other;
+    if (other->slots == NULL) {
+        return STL_Index_list_OK;
+    }
+
+    /* Links are indices, so the slots are copied as they are */
+    if ((self->slots = malloc(other->capacity * other->stride)) == NULL) {
+        STL_Index_list_init(self, other->nbytes);
+        return STL_Index_list_memory_error;
+    }
+    memcpy(self->slots, other->slots, other->capacity * other->stride);
+
+    /* Returning value */
+    return STL_Index_list_OK;
+}
+
+int STL_Index_list_init_data(STL_Index_list *self, size_t nbytes, const void *data, size_t size)
+{
+
+    /* Initializing variables */
+    auto STL_Index_list_links *links;
+    register size_t i, n;
+    auto int code;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_Index_list_null_reference_error;
+    }
+
+    /* Main part */
+    if ((code = STL_Index_list_init(self, nbytes)) != STL_Index_list_OK) {
+        return code;
+    }
+
+    if (size % self->stride || size / self->stride > (size_t) free_mark) {
+        return STL_Index_list_index_error;
+    }
+
+    /* data() of an empty list is NULL */
+    if (!size) {
+        return STL_Index_list_OK;
+    }
+
+    if (data == NULL) {
+        return STL_Index_list_null_reference_error;
+    }
+
+    if ((self->slots = malloc(size)) == NULL) {
+        return STL_Index_list_memory_error;
+    }
+    memcpy(self->slots, data, size);
+    self->capacity = size / self->stride;
+
+    /* Only the element count and the head of the unused slots aren't kept in the slots themselves */
+    for (i = self->capacity; i-- > 0;) {
+        links = STL_Index_list_links_at(self, (uint32_t) i);
+        if (links->prev == free_mark && i != 0) {
+            links->next = self->free;
+            self->free = (uint32_t) i;
+            continue;
+        }
+
+        /* Every used slot is what its neighbours point back at */
+        if (links->prev >= self->capacity || links->next >= self->capacity ||
+            STL_Index_list_links_at(self, links->next)->prev != i || STL_Index_list_links_at(self, links->prev)->next != i) {
+            break;
+        }
+        self->nelem += (i != 0);
+    }
+
+    /* All used slots are in one chain, from the end slot back to it */
+    n = (size_t) -1;
+    if (i == (size_t) -1) {
+        for (i = STL_Index_list_links_at(self, 0)->next, n = 0; i != 0 && n < self->nelem; ++n) {
+            i = STL_Index_list_links_at(self, (uint32_t) i)->next;
+        }
+    }
+
+    if (i != 0 || n != self->nelem) {
+        STL_Index_list_delete(self);
+        return STL_Index_list_index_error;
+    }
+
+    /* Returning value */
+    return STL_Index_list_OK;
+}
+
+void STL_Index_list_delete(STL_Index_list *self)
+{
+
+    /* Main part */
+    if (self == NULL) {
+        return;
+    }
+
+    free(self->slots);
+    STL_Index_list_init(self, self->nbytes);
+}
+
+void *STL_Index_list_front(STL_Index_list *self)
+{
+
+    /* VarCheck */
+    if (self == NULL || !self->nelem) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_Index_list_get(self, STL_Index_list_links_at(self, 0)->next);
+}
+
+void *STL_Index_list_back(STL_Index_list *self)
+{
+
+    /* VarCheck */
+    if (self == NULL || !self->nelem) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_Index_list_get(self, STL_Index_list_links_at(self, 0)->prev);
+}
+
+const void *STL_Index_list_data(const STL_Index_list *self)
+{
+
+    /* Returning value */
+    return (self != NULL) ? self->slots : NULL;
+}
+
+size_t STL_Index_list_data_size(const STL_Index_list *self)
+{
+
+    /* Returning value */
+    return (self != NULL) ? self->capacity * self->stride : 0;
+}
+
+uint32_t STL_Index_list_begin(STL_Index_list *self)
+{
+
+    /* Returning value */
+    return (self != NULL && self->slots != NULL) ? STL_Index_list_links_at(self, 0)->next : 0;
+}
+
+uint32_t STL_Index_list_end(STL_Index_list *self)
+{
+
+    /* Main part */
+    (void) self;
+
+    /* Returning value */
+    return 0;
+}
+
+void *STL_Index_list_get(STL_Index_list *self, uint32_t pos)
+{
+
+    /* VarCheck */
+    if (self == NULL || !pos || pos >= self->capacity) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return (char *) STL_Index_list_links_at(self, pos) + sizeof(STL_Index_list_links);
+}
+
+uint32_t STL_Index_list_next(STL_Index_list *self, uint32_t pos)
+{
+
+    /* VarCheck */
+    if (self == NULL || pos >= self->capacity) {
+        return 0;
+    }
+
+    /* Returning value */
+    return STL_Index_list_links_at(self, pos)->next;
+}
+
+uint32_t STL_Index_list_prev(STL_Index_list *self, uint32_t pos)
+{
+
+    /* VarCheck */
+    if (self == NULL || pos >= self->capacity) {
+        return 0;
+    }
+
+    /* Returning value */
+    return STL_Index_list_links_at(self, pos)->prev;
+}
+
+int STL_Index_list_empty(STL_Index_list *self)
+{
+
+    /* Returning value */
+    return (self == NULL || !self->nelem) ? index_list_is_empty : index_list_not_empty;
+}
+
+size_t STL_Index_list_size(STL_Index_list *self)
+{
+
+    /* Returning value */
+    return (self != NULL) ? self->nelem : 0;
+}
+
+int STL_Index_list_reserve(STL_Index_list *self, size_t new_cap)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_Index_list_null_reference_error;
+    }
+
+    /* Main part. One more slot for the end one */
+    if (new_cap >= self->capacity && !STL_Index_list_grow(self, new_cap + 1)) {
+        return STL_Index_list_memory_error;
+    }
+
+    /* Returning value */
+    return STL_Index_list_OK;
+}
+
+size_t STL_Index_list_capacity(STL_Index_list *self)
+{
+
+    /* Returning value */
+    return (self != NULL && self->capacity) ? self->capacity - 1 : 0;
+}
+
+void STL_Index_list_clear(STL_Index_list *self)
+{
+
+    /* Main part */
+    if (self == NULL || self->slots == NULL) {
+        return;
+    }
+
+    STL_Index_list_links_at(self, 0)->next = STL_Index_list_links_at(self, 0)->prev = 0;
+    self->nelem = 0;
+    self->free = 0;
+    STL_Index_list_free_slots(self, 1);
+}
+
+int STL_Index_list_insert(STL_Index_list *self, uint32_t *pos, const void *elem)
+{
+
+    /* Initializing variables */
+    auto STL_Index_list_links *links, *next;
+    auto uint32_t i;
+
+    /* VarCheck */
+    if (self == NULL || pos == NULL || elem == NULL) {
+        return STL_Index_list_null_reference_error;
+    }
+
+    if (*pos != 0 && !STL_Index_list_valid(self, *pos)) {
+        return STL_Index_list_index_error;
+    }
+
+    /* Main part */
+    if (!self->free && !STL_Index_list_grow(self, (self->capacity) ? self->capacity * 2 : first_capacity)) {
+        return STL_Index_list_memory_error;
+    }
+
+    i = self->free;
+    links = STL_Index_list_links_at(self, i);
+    self->free = links->next;
+
+    next = STL_Index_list_links_at(self, *pos);
+    links->next = *pos;
+    links->prev = next->prev;
+    STL_Index_list_links_at(self, next->prev)->next = i;
+    next->prev = i;
+
+    memcpy((char *) links + sizeof(STL_Index_list_links), elem, self->nbytes);
+    ++self->nelem;
+    *pos = i;
+
+    /* Returning value */
+    return STL_Index_list_OK;
+}
+
+int STL_Index_list_erase(STL_Index_list *self, uint32_t *pos)
+{
+
+    /* Initializing variables */
+    auto STL_Index_list_links *links;
+    auto uint32_t next;
+
+    /* VarCheck */
+    if (self == NULL || pos == NULL) {
+        return STL_Index_list_null_reference_error;
+    }
+
+    if (!STL_Index_list_valid(self, *pos)) {
+        return STL_Index_list_index_error;
+    }
+
+    /* Main part */
+    links = STL_Index_list_links_at(self, *pos);
+    next = links->next;
+    STL_Index_list_links_at(self, links->prev)->next = next;
+    STL_Index_list_links_at(self, next)->prev = links->prev;
+
+    links->prev = free_mark;
+    links->next = self->free;
+    self->free = *pos;
+    --self->nelem;
+
+    *pos = next;
+
+    /* Returning value */
+    return STL_Index_list_OK;
+}
+
+int STL_Index_list_push_back(STL_Index_list *self, const void *elem)
+{
+
+    /* Initializing variables */
+    auto uint32_t pos = 0;
+
+    /* Returning value */
+    return STL_Index_list_insert(self, &pos, elem);
+}
+
+void STL_Index_list_pop_back(STL_Index_list *self)
+{
+
+    /* Initializing variables */
+    auto uint32_t pos;
+
+    /* Main part */
+    if (self == NULL || !self->nelem) {
+        return;
+    }
+
+    pos = STL_Index_list_links_at(self, 0)->prev;
+    STL_Index_list_erase(self, &pos);
+}
+
+int STL_Index_list_push_front(STL_Index_list *self, const void *elem)
+{
+
+    /* Initializing variables */
+    auto uint32_t pos = STL_Index_list_begin(self);
+
+    /* Returning value */
+    return STL_Index_list_insert(self, &pos, elem);
+}
+
+void STL_Index_list_pop_front(STL_Index_list *self)
+{
+
+    /* Initializing variables */
+    auto uint32_t pos;
+
+    /* Main part */
+    if (self == NULL || !self->nelem) {
+        return;
+    }
+
+    pos = STL_Index_list_links_at(self, 0)->next;
+    STL_Index_list_erase(self, &pos);
+}
+
+void STL_Index_list_swap(STL_Index_list *self, STL_Index_list *other)
+{
+
+    /* Initializing variables */
+    auto STL_Index_list tmp;
+
+    /* Main part */
+    tmp = *other;
+    *other = *self;
+    *self = tmp;
+}
@@ -0,0 +1,375 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_Intrusive_forward_list.h"
+
+#include <string.h>
+
+static STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_merge_chains(
+    STL_Intrusive_forward_list_hook *a, STL_Intrusive_forward_list_hook *b,
+    int (*cmp)(const STL_Intrusive_forward_list_hook *, const STL_Intrusive_forward_list_hook *))
+{
+
+    /* Merges two sorted NULL-terminated chains. Hooks of "a" go first among equal ones */
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list_hook head, *tail = &head;
+
+    /* Main part */
+    while (a != NULL && b != NULL) {
+        if (cmp(b, a) < 0) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (a != NULL) ? a : b;
+
+    /* Returning value */
+    return head.next;
+}
+
+int STL_Intrusive_forward_list_init(STL_Intrusive_forward_list *l)
+{
+
+    /* Main part */
+    if (l == NULL) {
+        return STL_Intrusive_forward_list_null_reference_error;
+    }
+
+    l->head.next = NULL;
+    l->size = 0;
+
+    /* Returning value */
+    return STL_Intrusive_forward_list_OK;
+}
+
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_front(STL_Intrusive_forward_list *l)
+{
+
+    /* VarCheck */
+    if (l == NULL) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return l->head.next;
+}
+
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_before_begin(STL_Intrusive_forward_list *l)
+{
+
+    /* Returning value */
+    return &l->head;
+}
+
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_begin(STL_Intrusive_forward_list *l)
+{
+
+    /* Returning value */
+    return l->head.next;
+}
+
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_end(STL_Intrusive_forward_list *l)
+{
+
+    /* Main part */
+    (void) l;
+
+    /* Returning value */
+    return NULL;
+}
+
+int STL_Intrusive_forward_list_empty(const STL_Intrusive_forward_list *l)
+{
+
+    /* Returning value */
+    return (l->size) ? intrusive_forward_list_not_empty : intrusive_forward_list_is_empty;
+}
+
+size_t STL_Intrusive_forward_list_size(const STL_Intrusive_forward_list *l)
+{
+
+    /* Main part */
+    if (l == NULL) {
+        return 0;
+    }
+
+    /* Returning value */
+    return l->size;
+}
+
+void STL_Intrusive_forward_list_clear(STL_Intrusive_forward_list *l)
+{
+
+    /* Initializing variables */
+    register STL_Intrusive_forward_list_hook *iter, *next;
+
+    /* Main part */
+    if (l == NULL) {
+        return;
+    }
+
+    /* Hooks are reset one by one, so an unlinked hook always has a NULL next */
+    for (iter = l->head.next; iter != NULL; iter = next) {
+        next = iter->next;
+        iter->next = NULL;
+    }
+
+    l->head.next = NULL;
+    l->size = 0;
+}
+
+int STL_Intrusive_forward_list_insert_after(STL_Intrusive_forward_list *l, STL_Intrusive_forward_list_hook *pos,
+                                            STL_Intrusive_forward_list_hook *hook)
+{
+
+    /* VarCheck */
+    if (l == NULL || pos == NULL || hook == NULL) {
+        return STL_Intrusive_forward_list_null_reference_error;
+    }
+
+    /* Main part */
+    hook->next = pos->next;
+    pos->next = hook;
+    ++l->size;
+
+    /* Returning value */
+    return STL_Intrusive_forward_list_OK;
+}
+
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_erase_after(STL_Intrusive_forward_list *l,
+                                                                        STL_Intrusive_forward_list_hook *pos)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list_hook *victim;
+
+    /* VarCheck */
+    if (l == NULL || pos == NULL || (victim = pos->next) == NULL) {
+        return NULL;
+    }
+
+    /* Main part */
+    pos->next = victim->next;
+    victim->next = NULL;
+    --l->size;
+
+    /* Returning value */
+    return pos->next;
+}
+
+int STL_Intrusive_forward_list_push_front(STL_Intrusive_forward_list *l, STL_Intrusive_forward_list_hook *hook)
+{
+
+    /* Returning value */
+    return STL_Intrusive_forward_list_insert_after(l, &l->head, hook);
+}
+
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_pop_front(STL_Intrusive_forward_list *l)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list_hook *hook;
+
+    /* Main part */
+    if ((hook = STL_Intrusive_forward_list_front(l)) != NULL) {
+        STL_Intrusive_forward_list_erase_after(l, &l->head);
+    }
+
+    /* Returning value */
+    return hook;
+}
+
+void STL_Intrusive_forward_list_swap(STL_Intrusive_forward_list *self, STL_Intrusive_forward_list *other)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list tmp;
+
+    /* Main part */
+    tmp = *other;
+    *other = *self;
+    *self = tmp;
+}
+
+int STL_Intrusive_forward_list_splice_after(STL_Intrusive_forward_list *self, STL_Intrusive_forward_list_hook *pos,
+                                            STL_Intrusive_forward_list *other)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list_hook *last;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL) {
+        return STL_Intrusive_forward_list_null_reference_error;
+    }
+
+    /* Main part */
+    if (self == other || !other->size) {
+        return STL_Intrusive_forward_list_OK;
+    }
+
+    for (last = other->head.next; last->next != NULL; last = last->next)
+        ;
+    last->next = pos->next;
+    pos->next = other->head.next;
+    other->head.next = NULL;
+
+    self->size += other->size;
+    other->size = 0;
+
+    /* Returning value */
+    return STL_Intrusive_forward_list_OK;
+}
+
+int STL_Intrusive_forward_list_splice_after_hook(STL_Intrusive_forward_list *self, STL_Intrusive_forward_list_hook *pos,
+                                                 STL_Intrusive_forward_list *other,
+                                                 STL_Intrusive_forward_list_hook *before)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list_hook *hook;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL || before == NULL) {
+        return STL_Intrusive_forward_list_null_reference_error;
+    }
+
+    if ((hook = before->next) == NULL) {
+        return STL_Intrusive_forward_list_index_error;
+    }
+
+    /* Main part */
+    if (pos == before || pos == hook) {
+        return STL_Intrusive_forward_list_OK;
+    }
+
+    before->next = hook->next;
+    hook->next = pos->next;
+    pos->next = hook;
+
+    ++self->size;
+    --other->size;
+
+    /* Returning value */
+    return STL_Intrusive_forward_list_OK;
+}
+
+int STL_Intrusive_forward_list_splice_after_range(STL_Intrusive_forward_list *self, STL_Intrusive_forward_list_hook *pos,
+                                                  STL_Intrusive_forward_list *other,
+                                                  STL_Intrusive_forward_list_hook *first,
+                                                  STL_Intrusive_forward_list_hook *last)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list_hook *tail, *chain;
+    register size_t n;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL || first == NULL) {
+        return STL_Intrusive_forward_list_null_reference_error;
+    }
+
+    /* Main part */
+    if (first == last || first->next == last) {
+        return STL_Intrusive_forward_list_OK;
+    }
+
+    /* The hook before "last" has to be found anyway, so the count comes for free */
+    for (tail = first, n = 0; tail->next != last; tail = tail->next, ++n) {
+        if (tail->next == NULL) {
+            return STL_Intrusive_forward_list_index_error;
+        }
+    }
+
+    chain = first->next;
+    first->next = last;
+    tail->next = pos->next;
+    pos->next = chain;
+
+    self->size += n;
+    other->size -= n;
+
+    /* Returning value */
+    return STL_Intrusive_forward_list_OK;
+}
+
+void STL_Intrusive_forward_list_reverse(STL_Intrusive_forward_list *l)
+{
+
+    /* Initializing variables */
+    register STL_Intrusive_forward_list_hook *iter, *prev, *next;
+
+    /* VarCheck */
+    if (l == NULL) {
+        return;
+    }
+
+    /* Main part */
+    for (prev = NULL, iter = l->head.next; iter != NULL; iter = next) {
+        next = iter->next;
+        iter->next = prev;
+        prev = iter;
+    }
+
+    l->head.next = prev;
+}
+
+void STL_Intrusive_forward_list_sort(STL_Intrusive_forward_list *l,
+                                     int (*cmp)(const STL_Intrusive_forward_list_hook *,
+                                                const STL_Intrusive_forward_list_hook *))
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list_hook *bins[sizeof(size_t) * 8], *chain, *node;
+    register size_t i;
+
+    /* VarCheck */
+    if (l == NULL || cmp == NULL || l->size < 2) {
+        return;
+    }
+
+    /* Main part */
+    /* Bottom-up: bins[i] holds a sorted run of 2^i hooks, each one older than everything in lower bins */
+    memset(bins, 0, sizeof(bins));
+    for (chain = l->head.next; chain != NULL;) {
+        node = chain;
+        chain = chain->next;
+        node->next = NULL;
+
+        for (i = 0; bins[i] != NULL; ++i) {
+            node = STL_Intrusive_forward_list_merge_chains(bins[i], node, cmp);
+            bins[i] = NULL;
+        }
+        bins[i] = node;
+    }
+
+    for (i = 0, node = NULL; i < sizeof(bins) / sizeof(*bins); ++i) {
+        if (bins[i] != NULL) {
+            node = (node == NULL) ? bins[i] : STL_Intrusive_forward_list_merge_chains(bins[i], node, cmp);
+        }
+    }
+
+    l->head.next = node;
+}
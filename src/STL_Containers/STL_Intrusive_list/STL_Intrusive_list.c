@@ -0,0 +1,436 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_Intrusive_list.h"
+
+#include <string.h>
+
+static void STL_Intrusive_list_link(STL_Intrusive_list_hook *pos, STL_Intrusive_list_hook *first,
+                                    STL_Intrusive_list_hook *last)
+{
+
+    /* Puts hooks from "first" to "last" inclusive before "pos" */
+
+    /* Main part */
+    first->prev = pos->prev;
+    last->next = pos;
+    pos->prev->next = first;
+    pos->prev = last;
+}
+
+static void STL_Intrusive_list_unlink(STL_Intrusive_list_hook *first, STL_Intrusive_list_hook *last)
+{
+
+    /* Cuts hooks from "first" to "last" inclusive out of their list */
+
+    /* Main part */
+    first->prev->next = last->next;
+    last->next->prev = first->prev;
+}
+
+static STL_Intrusive_list_hook *STL_Intrusive_list_merge_chains(STL_Intrusive_list_hook *a,
+                                                                STL_Intrusive_list_hook *b,
+                                                                int (*cmp)(const STL_Intrusive_list_hook *,
+                                                                           const STL_Intrusive_list_hook *))
+{
+
+    /* Merges two sorted NULL-terminated chains through "next" only. Hooks of "a" go first among equal ones */
+
+    /* Initializing variables */
+    auto STL_Intrusive_list_hook head, *tail = &head;
+
+    /* Main part */
+    while (a != NULL && b != NULL) {
+        if (cmp(b, a) < 0) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (a != NULL) ? a : b;
+
+    /* Returning value */
+    return head.next;
+}
+
+int STL_Intrusive_list_init(STL_Intrusive_list *l)
+{
+
+    /* Main part */
+    if (l == NULL) {
+        return STL_Intrusive_list_null_reference_error;
+    }
+
+    l->head.next = l->head.prev = &l->head;
+    l->size = 0;
+
+    /* Returning value */
+    return STL_Intrusive_list_OK;
+}
+
+void STL_Intrusive_list_hook_init(STL_Intrusive_list_hook *hook)
+{
+
+    /* Main part */
+    hook->next = hook->prev = NULL;
+}
+
+int STL_Intrusive_list_is_linked(const STL_Intrusive_list_hook *hook)
+{
+
+    /* Returning value */
+    return hook->next != NULL;
+}
+
+STL_Intrusive_list_hook *STL_Intrusive_list_front(STL_Intrusive_list *l)
+{
+
+    /* VarCheck */
+    if (l == NULL || !l->size) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return l->head.next;
+}
+
+STL_Intrusive_list_hook *STL_Intrusive_list_back(STL_Intrusive_list *l)
+{
+
+    /* VarCheck */
+    if (l == NULL || !l->size) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return l->head.prev;
+}
+
+STL_Intrusive_list_hook *STL_Intrusive_list_begin(STL_Intrusive_list *l)
+{
+
+    /* Returning value */
+    return l->head.next;
+}
+
+STL_Intrusive_list_hook *STL_Intrusive_list_end(STL_Intrusive_list *l)
+{
+
+    /* Returning value */
+    return &l->head;
+}
+
+int STL_Intrusive_list_empty(const STL_Intrusive_list *l)
+{
+
+    /* Returning value */
+    return (l->size) ? intrusive_list_not_empty : intrusive_list_is_empty;
+}
+
+size_t STL_Intrusive_list_size(const STL_Intrusive_list *l)
+{
+
+    /* Main part */
+    if (l == NULL) {
+        return 0;
+    }
+
+    /* Returning value */
+    return l->size;
+}
+
+void STL_Intrusive_list_clear(STL_Intrusive_list *l)
+{
+
+    /* Initializing variables */
+    register STL_Intrusive_list_hook *iter, *next;
+
+    /* Main part */
+    if (l == NULL) {
+        return;
+    }
+
+    /* Hooks are reset one by one, so STL_Intrusive_list_is_linked() stays right */
+    for (iter = l->head.next; iter != &l->head; iter = next) {
+        next = iter->next;
+        STL_Intrusive_list_hook_init(iter);
+    }
+
+    l->head.next = l->head.prev = &l->head;
+    l->size = 0;
+}
+
+int STL_Intrusive_list_insert(STL_Intrusive_list *l, STL_Intrusive_list_hook *pos, STL_Intrusive_list_hook *hook)
+{
+
+    /* VarCheck */
+    if (l == NULL || pos == NULL || hook == NULL) {
+        return STL_Intrusive_list_null_reference_error;
+    }
+
+    /* Main part */
+    STL_Intrusive_list_link(pos, hook, hook);
+    ++l->size;
+
+    /* Returning value */
+    return STL_Intrusive_list_OK;
+}
+
+STL_Intrusive_list_hook *STL_Intrusive_list_erase(STL_Intrusive_list *l, STL_Intrusive_list_hook *hook)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_list_hook *ret;
+
+    /* VarCheck */
+    if (l == NULL || hook == NULL || hook == &l->head || !l->size) {
+        return NULL;
+    }
+
+    /* Main part */
+    ret = hook->next;
+    STL_Intrusive_list_unlink(hook, hook);
+    STL_Intrusive_list_hook_init(hook);
+    --l->size;
+
+    /* Returning value */
+    return ret;
+}
+
+int STL_Intrusive_list_push_back(STL_Intrusive_list *l, STL_Intrusive_list_hook *hook)
+{
+
+    /* Returning value */
+    return STL_Intrusive_list_insert(l, STL_Intrusive_list_end(l), hook);
+}
+
+STL_Intrusive_list_hook *STL_Intrusive_list_pop_back(STL_Intrusive_list *l)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_list_hook *hook;
+
+    /* Main part */
+    if ((hook = STL_Intrusive_list_back(l)) != NULL) {
+        STL_Intrusive_list_erase(l, hook);
+    }
+
+    /* Returning value */
+    return hook;
+}
+
+int STL_Intrusive_list_push_front(STL_Intrusive_list *l, STL_Intrusive_list_hook *hook)
+{
+
+    /* Returning value */
+    return STL_Intrusive_list_insert(l, STL_Intrusive_list_begin(l), hook);
+}
+
+STL_Intrusive_list_hook *STL_Intrusive_list_pop_front(STL_Intrusive_list *l)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_list_hook *hook;
+
+    /* Main part */
+    if ((hook = STL_Intrusive_list_front(l)) != NULL) {
+        STL_Intrusive_list_erase(l, hook);
+    }
+
+    /* Returning value */
+    return hook;
+}
+
+void STL_Intrusive_list_swap(STL_Intrusive_list *self, STL_Intrusive_list *other)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_list tmp;
+
+    /* Main part */
+    STL_Intrusive_list_init(&tmp);
+    STL_Intrusive_list_splice(&tmp, &tmp.head, other);
+    STL_Intrusive_list_splice(other, &other->head, self);
+    STL_Intrusive_list_splice(self, &self->head, &tmp);
+}
+
+int STL_Intrusive_list_splice(STL_Intrusive_list *self, STL_Intrusive_list_hook *pos, STL_Intrusive_list *other)
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_list_hook *first, *last;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL) {
+        return STL_Intrusive_list_null_reference_error;
+    }
+
+    /* Main part */
+    if (self == other || !other->size) {
+        return STL_Intrusive_list_OK;
+    }
+
+    first = other->head.next;
+    last = other->head.prev;
+    STL_Intrusive_list_unlink(first, last);
+    STL_Intrusive_list_link(pos, first, last);
+
+    self->size += other->size;
+    other->size = 0;
+
+    /* Returning value */
+    return STL_Intrusive_list_OK;
+}
+
+int STL_Intrusive_list_splice_hook(STL_Intrusive_list *self, STL_Intrusive_list_hook *pos, STL_Intrusive_list *other,
+                                   STL_Intrusive_list_hook *hook)
+{
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL || hook == NULL) {
+        return STL_Intrusive_list_null_reference_error;
+    }
+
+    if (hook == &other->head) {
+        return STL_Intrusive_list_index_error;
+    }
+
+    /* Main part */
+    if (hook == pos || hook->next == pos) {
+        return STL_Intrusive_list_OK;
+    }
+
+    STL_Intrusive_list_unlink(hook, hook);
+    STL_Intrusive_list_link(pos, hook, hook);
+
+    ++self->size;
+    --other->size;
+
+    /* Returning value */
+    return STL_Intrusive_list_OK;
+}
+
+int STL_Intrusive_list_splice_range(STL_Intrusive_list *self, STL_Intrusive_list_hook *pos, STL_Intrusive_list *other,
+                                    STL_Intrusive_list_hook *first, STL_Intrusive_list_hook *last)
+{
+
+    /* Initializing variables */
+    register STL_Intrusive_list_hook *iter;
+    register size_t n;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL || first == NULL || last == NULL) {
+        return STL_Intrusive_list_null_reference_error;
+    }
+
+    /* Main part */
+    if (first == last || pos == first) {
+        return STL_Intrusive_list_OK;
+    }
+
+    /* Only moves between lists have to count the hooks */
+    if (self != other) {
+        for (iter = first, n = 0; iter != last; iter = iter->next, ++n) {
+            if (iter == &other->head) {
+                return STL_Intrusive_list_index_error;
+            }
+        }
+
+        self->size += n;
+        other->size -= n;
+    }
+
+    iter = last->prev;
+    STL_Intrusive_list_unlink(first, iter);
+    STL_Intrusive_list_link(pos, first, iter);
+
+    /* Returning value */
+    return STL_Intrusive_list_OK;
+}
+
+void STL_Intrusive_list_reverse(STL_Intrusive_list *l)
+{
+
+    /* Initializing variables */
+    register STL_Intrusive_list_hook *iter, *next;
+
+    /* VarCheck */
+    if (l == NULL) {
+        return;
+    }
+
+    /* Main part */
+    /* The head is turned around too, so it starts at the old last hook */
+    iter = &l->head;
+    do {
+        next = iter->next;
+        iter->next = iter->prev;
+        iter->prev = next;
+        iter = next;
+    } while (iter != &l->head);
+}
+
+void STL_Intrusive_list_sort(STL_Intrusive_list *l,
+                             int (*cmp)(const STL_Intrusive_list_hook *, const STL_Intrusive_list_hook *))
+{
+
+    /* Initializing variables */
+    auto STL_Intrusive_list_hook *bins[sizeof(size_t) * 8], *chain, *node, *prev;
+    register size_t i;
+
+    /* VarCheck */
+    if (l == NULL || cmp == NULL || l->size < 2) {
+        return;
+    }
+
+    /* Main part */
+    chain = l->head.next;
+    l->head.prev->next = NULL;
+
+    /* Bottom-up: bins[i] holds a sorted run of 2^i hooks, each one older than everything in lower bins */
+    memset(bins, 0, sizeof(bins));
+    while (chain != NULL) {
+        node = chain;
+        chain = chain->next;
+        node->next = NULL;
+
+        for (i = 0; bins[i] != NULL; ++i) {
+            node = STL_Intrusive_list_merge_chains(bins[i], node, cmp);
+            bins[i] = NULL;
+        }
+        bins[i] = node;
+    }
+
+    for (i = 0, node = NULL; i < sizeof(bins) / sizeof(*bins); ++i) {
+        if (bins[i] != NULL) {
+            node = (node == NULL) ? bins[i] : STL_Intrusive_list_merge_chains(bins[i], node, cmp);
+        }
+    }
+
+    /* "prev" links are restored in one last pass */
+    for (prev = &l->head, prev->next = node; node != NULL; prev = node, node = node->next) {
+        node->prev = prev;
+    }
+    prev->next = &l->head;
+    l->head.prev = prev;
+}
@@ -23,6 +23,37 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 #include <stdlib.h>
 #include <string.h>
 
+/* Elements are stored right after the node, 16-byte aligned */
+static const size_t node_header = (sizeof(STL_List_node) + 15) & ~(size_t) 15;
+
+/* Position of a node in the middle of the list, which would take a walk to find */
+static const size_t unknown_rank = (size_t) -1;
+
+static STL_List_node *STL_List_new_node(STL_List *l, const void *elem, size_t size)
+{
+
+    /* Initializing variables */
+    auto STL_List_node *node;
+
+    /* Main part */
+    if ((node = __STL_Pool_alloc(&l->pool, node_header + size)) == NULL) {
+        return NULL;
+    }
+
+    node->value = (char *) node + node_header;
+    node->size = size;
+    memcpy(node->value, elem, size);
+
+    /* Returning value */
+    return node;
+}
+
+static void STL_List_free_node(STL_List *l, STL_List_node *node)
+{
+
+    /* Main part */
+    __STL_Pool_free(&l->pool, node, node_header + node->size);
+}
 
 static void STL_List_check_pointers(STL_List *l)
 {
@@ -35,6 +66,175 @@ static void STL_List_check_pointers(STL_List *l)
     }
 }
 
+static STL_List_node *STL_List_last(STL_List *l)
+{
+
+    /* Returning value */
+    return STL_List_end(l)->prev;
+}
+
+static size_t STL_List_known_rank(STL_List *l, STL_List_node *pos)
+{
+
+    /* Main part */
+    if (pos == STL_List_begin(l)) {
+        return 0;
+    } else if (pos == STL_List_end(l)) {
+        return l->size;
+    } else if (pos == STL_List_last(l)) {
+        return l->size - 1;
+    }
+
+    /* Returning value */
+    return unknown_rank;
+}
+
+static void STL_List_index_stale(STL_List *l)
+{
+
+    /* Main part */
+    if (l->index != NULL) {
+        l->index->stale = 1;
+    }
+}
+
+static int STL_List_index_ready(STL_List *l)
+{
+
+    /* Rebuilds the index if it is out of date. Returns 1 if it can be used */
+
+    /* Initializing variables */
+    register STL_List_node *iter;
+    register size_t i;
+    auto void **items;
+    auto int built;
+
+    /* Main part */
+    if (l->index == NULL) {
+        return 0;
+    }
+
+    if (l->index->stale) {
+        if ((items = malloc((l->size + 1) * sizeof(*items))) == NULL) {
+            return 0;
+        }
+
+        for (iter = STL_List_begin(l), i = 0; iter != STL_List_end(l); iter = iter->next) {
+            items[i++] = iter;
+        }
+        built = __STL_Rank_tree_build(l->index, items, l->size);
+        free(items);
+
+        if (!built) {
+            l->index->stale = 1;
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return 1;
+}
+
+static void STL_List_index_insert(STL_List *l, size_t rank, STL_List_node *node)
+{
+
+    /* Main part */
+    if (l->index != NULL && !l->index->stale &&
+        (rank == unknown_rank || !__STL_Rank_tree_insert(l->index, rank, node))) {
+        l->index->stale = 1;
+    }
+}
+
+static void STL_List_index_erase(STL_List *l, size_t rank)
+{
+
+    /* Main part */
+    if (l->index == NULL || l->index->stale) {
+        return;
+    }
+
+    if (rank == unknown_rank) {
+        l->index->stale = 1;
+    } else {
+        __STL_Rank_tree_erase(l->index, rank);
+    }
+}
+
+static void STL_List_unlink(STL_List *l, STL_List_node *first, STL_List_node *last)
+{
+
+    /* Cuts nodes from "first" to "last" inclusive out of the list. The end node always follows them */
+
+    /* Main part */
+    if (first->prev != NULL) {
+        first->prev->next = last->next;
+    } else {
+        l->bp = last->next;
+    }
+    last->next->prev = first->prev;
+}
+
+static void STL_List_relink(STL_List *l, STL_List_node *pos, STL_List_node *first, STL_List_node *last)
+{
+
+    /* Puts nodes from "first" to "last" inclusive before "pos" */
+
+    /* Main part */
+    first->prev = pos->prev;
+    last->next = pos;
+
+    if (pos->prev != NULL) {
+        pos->prev->next = first;
+    } else {
+        l->bp = first;
+    }
+    pos->prev = last;
+}
+
+static STL_List_node *STL_List_merge_chains(STL_List_node *a, STL_List_node *b, int (*cmp)(const void *, const void *))
+{
+
+    /* Merges two sorted NULL-terminated chains through "next" only. Nodes of "a" go first among equal ones */
+
+    /* Initializing variables */
+    auto STL_List_node head, *tail = &head;
+
+    /* Main part */
+    while (a != NULL && b != NULL) {
+        if (cmp(b->value, a->value) < 0) {
+            tail->next = b;
+            b = b->next;
+        } else {
+            tail->next = a;
+            a = a->next;
+        }
+        tail = tail->next;
+    }
+    tail->next = (a != NULL) ? a : b;
+
+    /* Returning value */
+    return head.next;
+}
+
+static void STL_List_link_chain(STL_List *l, STL_List_node *chain, STL_List_node *rest)
+{
+
+    /* Makes a NULL-terminated chain the front of the list, followed by "rest", and restores "prev" */
+
+    /* Initializing variables */
+    auto STL_List_node *prev = NULL;
+
+    /* Main part */
+    for (l->bp = chain; chain != NULL; prev = chain, chain = chain->next) {
+        chain->prev = prev;
+        if (chain->next == NULL) {
+            chain->next = rest;
+            rest->prev = chain;
+            break;
+        }
+    }
+}
+
 int STL_List_init(STL_List *l)
 {
 
@@ -52,6 +252,9 @@ int STL_List_init(STL_List *l)
     l->bp->next = l->bp->prev = l->bp->value = NULL;
     l->bp->size = 0;
 
+    __STL_Pool_init(&l->pool);
+    l->index = NULL;
+
     /* Returning value */
     return STL_List_OK;
 }
@@ -61,16 +264,40 @@ int STL_List_init_cpy(STL_List *self, STL_List *other)
 
     /* Initializing variables */
     register STL_List_node *iter;
+    auto STL_List_node *node, *last = NULL;
     auto int code;
 
     /* Main part */
     code = STL_List_init(self);
-    if (other == NULL || code != STL_List_OK) {
+    if (other == NULL || code != STL_List_OK || STL_List_empty(other)) {
         return code;
     }
 
+    /* One pass: nodes are copied whole and linked in order, the pool pre-sized for the size of the first one */
+    STL_List_reserve(self, other->size, STL_List_begin(other)->size);
     for (iter = STL_List_begin(other); iter != STL_List_end(other); iter = iter->next) {
-        STL_List_push_back(self, iter->value, iter->size);
+        if ((node = STL_List_new_node(self, iter->value, iter->size)) == NULL) {
+            break;
+        }
+
+        node->prev = last;
+        if (last != NULL) {
+            last->next = node;
+        } else {
+            self->bp = node;
+        }
+        last = node;
+        ++self->size;
+    }
+
+    if (last != NULL) {
+        last->next = self->lp;
+        self->lp->prev = last;
+    }
+
+    if (iter != STL_List_end(other)) {
+        STL_List_delete(self);
+        return STL_List_memory_error;
     }
 
     /* Returning value */
@@ -86,6 +313,7 @@ void STL_List_delete(STL_List *l)
     }
 
     STL_List_clear(l);
+    STL_List_disable_index(l);
 
     free(l->bp);
 }
@@ -158,67 +386,234 @@ size_t STL_List_size(STL_List *l)
 void STL_List_clear(STL_List *l)
 {
 
+    /* Initializing variables */
+    register STL_List_node *iter, *next;
+
     /* Main part */
     if (l == NULL) {
         return;
     }
 
-    while (l->size) {
-        STL_List_pop_back(l);
+    /* Nodes too big for the slabs, or maybe living in slabs of other lists, are freed one by one. The rest goes with the slabs */
+    if (l->pool.nlarge || l->pool.home != NULL) {
+        for (iter = STL_List_begin(l); iter != STL_List_end(l); iter = next) {
+            next = iter->next;
+            STL_List_free_node(l, iter);
+        }
     }
 
-    STL_List_check_pointers(l);
+    __STL_Pool_release(&l->pool);
+
+    if (l->index != NULL) {
+        __STL_Rank_tree_clear(l->index);
+    }
+
+    l->bp = l->lp;
+    l->lp->prev = NULL;
+    l->size = 0;
 }
 
-int STL_List_insert_at(STL_List *l, const void *elem, size_t size, size_t pos)
+int STL_List_reserve(STL_List *l, size_t n, size_t size)
 {
 
-    /* Initializing variables */
-    register size_t i;
-    auto STL_List_node *iter;
+    /* VarCheck */
+    if (l == NULL) {
+        return STL_List_null_reference_error;
+    }
 
     /* Main part */
-    if (l == NULL || elem == NULL) {
+    if (!__STL_Pool_reserve(&l->pool, node_header + size, n)) {
+        return STL_List_memory_error;
+    }
+
+    /* Returning value */
+    return STL_List_OK;
+}
+
+int STL_List_compact(STL_List *l)
+{
+
+    /* Initializing variables */
+    register STL_List_node *iter;
+    auto STL_List_node *node, *last = NULL, *next;
+    auto size_t nbytes = 0;
+    auto __STL_Pool pool;
+
+    /* VarCheck */
+    if (l == NULL) {
         return STL_List_null_reference_error;
     }
 
-    if (pos > l->size) {
-        return STL_List_index_error;
+    /* Main part */
+    for (iter = STL_List_begin(l); iter != STL_List_end(l); iter = iter->next) {
+        nbytes += __STL_Pool_block_size(node_header + iter->size);
     }
 
-    if (pos > l->size / 2) {
-        for (iter = STL_List_end(l), i = l->size; iter->prev != NULL && i >= pos; iter = iter->prev, --i)
-            ;
-    } else {
-        for (iter = STL_List_begin(l), i = 0; iter != STL_List_end(l) && i < pos; iter = iter->next, ++i)
-            ;
+    /* The run is allocated up front, so the list is left as it was if memory runs out */
+    __STL_Pool_init(&pool);
+    if (nbytes && !__STL_Pool_run(&pool, nbytes)) {
+        return STL_List_memory_error;
+    }
+
+    /* Nodes are laid out in traversal order. Large ones already have a malloc() block each */
+    for (iter = STL_List_begin(l); iter != STL_List_end(l); iter = next) {
+        next = iter->next;
+        if (__STL_Pool_block_size(node_header + iter->size) != 0) {
+            node = __STL_Pool_run_alloc(&pool, node_header + iter->size);
+            memcpy(node, iter, node_header + iter->size);
+            node->value = (char *) node + node_header;
+
+            /* Old nodes of a shared pool have to be handed back before it is released */
+            if (l->pool.home != NULL) {
+                __STL_Pool_free(&l->pool, iter, node_header + node->size);
+            }
+        } else {
+            node = iter;
+        }
+
+        node->prev = last;
+        if (last != NULL) {
+            last->next = node;
+        } else {
+            l->bp = node;
+        }
+        last = node;
+    }
+
+    if (last != NULL) {
+        last->next = l->lp;
+        l->lp->prev = last;
     }
 
+    pool.nlarge = l->pool.nlarge;
+    __STL_Pool_release(&l->pool);
+    l->pool = pool;
+    STL_List_index_stale(l);
+
     /* Returning value */
-    return STL_List_insert(l, elem, size, iter);
+    return STL_List_OK;
 }
 
-int STL_List_insert(STL_List *l, const void *elem, size_t size, STL_List_node *pos)
+double STL_List_fragmentation(STL_List *l)
 {
 
     /* Initializing variables */
-    auto STL_List_node *new_element;
+    register STL_List_node *iter;
+    auto STL_List_node *prev = NULL;
+    auto size_t nlinks = 0, nscattered = 0;
+
+    /* VarCheck */
+    if (l == NULL) {
+        return 0.0;
+    }
 
     /* Main part */
-    if (l == NULL || elem == NULL) {
+    for (iter = STL_List_begin(l); iter != STL_List_end(l); iter = iter->next) {
+        if (__STL_Pool_block_size(node_header + iter->size) == 0) {
+            continue;
+        }
+
+        /* Large nodes are skipped: they are never moved anyway */
+        if (prev != NULL) {
+            ++nlinks;
+            if (!__STL_Pool_adjacent(prev, node_header + prev->size, iter)) {
+                ++nscattered;
+            }
+        }
+        prev = iter;
+    }
+
+    /* Returning value */
+    return (nlinks) ? (double) nscattered / (double) nlinks : 0.0;
+}
+
+int STL_List_enable_index(STL_List *l)
+{
+
+    /* VarCheck */
+    if (l == NULL) {
         return STL_List_null_reference_error;
     }
 
-    /* Inserting element */
-    if ((new_element = (STL_List_node *) calloc(1, sizeof(STL_List_node))) == NULL) {
+    /* Main part */
+    if (l->index != NULL) {
+        return STL_List_OK;
+    }
+
+    if ((l->index = malloc(sizeof(__STL_Rank_tree))) == NULL) {
         return STL_List_memory_error;
     }
-    if ((new_element->value = malloc(size)) == NULL) {
+
+    __STL_Rank_tree_init(l->index);
+    l->index->stale = 1;
+    if (!STL_List_index_ready(l)) {
+        STL_List_disable_index(l);
         return STL_List_memory_error;
     }
 
-    memcpy(new_element->value, elem, size);
-    new_element->size = size;
+    /* Returning value */
+    return STL_List_OK;
+}
+
+void STL_List_disable_index(STL_List *l)
+{
+
+    /* Main part */
+    if (l == NULL || l->index == NULL) {
+        return;
+    }
+
+    __STL_Rank_tree_clear(l->index);
+    free(l->index);
+    l->index = NULL;
+}
+
+STL_List_node *STL_List_node_at(STL_List *l, size_t pos)
+{
+
+    /* Initializing variables */
+    register STL_List_node *iter;
+    register size_t i;
+
+    /* VarCheck */
+    if (l == NULL) {
+        return NULL;
+    }
+
+    /* Main part */
+    if (pos >= l->size) {
+        return STL_List_end(l);
+    }
+
+    if (STL_List_index_ready(l)) {
+        return __STL_Rank_tree_at(l->index, pos);
+    }
+
+    if (pos > l->size / 2) {
+        for (iter = STL_List_end(l), i = l->size; i > pos; --i) {
+            iter = iter->prev;
+        }
+    } else {
+        for (iter = STL_List_begin(l), i = 0; i < pos; ++i) {
+            iter = iter->next;
+        }
+    }
+
+    /* Returning value */
+    return iter;
+}
+
+static int STL_List_insert_node(STL_List *l, const void *elem, size_t size, STL_List_node *pos, size_t rank)
+{
+
+    /* Initializing variables */
+    auto STL_List_node *new_element;
+
+    /* Main part */
+    /* Inserting element */
+    if ((new_element = STL_List_new_node(l, elem, size)) == NULL) {
+        return STL_List_memory_error;
+    }
 
     if (pos != NULL) {
         new_element->next = pos;
@@ -239,8 +634,9 @@ int STL_List_insert(STL_List *l, const void *elem, size_t size, STL_List_node *p
         STL_List_check_pointers(l);
 
         ++l->size;
+        STL_List_index_insert(l, rank, new_element);
     } else {
-        free(new_element);
+        STL_List_free_node(l, new_element);
     }
 
 
@@ -248,38 +644,14 @@ int STL_List_insert(STL_List *l, const void *elem, size_t size, STL_List_node *p
     return STL_List_OK;
 }
 
-STL_List_node *STL_List_erase_at(STL_List *l, size_t pos)
-{
-
-    /* Initializing variables */
-    register size_t i;
-    auto STL_List_node *iter;
-
-    /* Main part */
-    if (l == NULL || STL_List_empty(l)) {
-        return NULL;
-    }
-
-    if (pos > l->size / 2) {
-        for (iter = STL_List_end(l), i = l->size; iter->prev != NULL && i >= pos; iter = iter->prev, --i)
-            ;
-    } else {
-        for (iter = STL_List_begin(l), i = 0; iter->next != STL_List_end(l) && i <= pos; iter = iter->next, ++i)
-            ;
-    }
-
-    /* Returning value */
-    return STL_List_erase(l, iter);
-}
-
-STL_List_node *STL_List_erase(STL_List *l, STL_List_node *pos)
+static STL_List_node *STL_List_erase_node(STL_List *l, STL_List_node *pos, size_t rank)
 {
 
     /* Initializing variables */
     auto STL_List_node *ret;
 
     /* Main part */
-    if (l == NULL || pos == NULL || STL_List_empty(l)) {
+    if (pos == NULL || STL_List_empty(l)) {
         return NULL;
     }
 
@@ -298,15 +670,15 @@ STL_List_node *STL_List_erase(STL_List *l, STL_List_node *pos)
         l->lp = pos->prev;
     }
 
-    free(pos->value);
     if (pos->next == NULL) {
         ret = STL_List_end(l);
     } else {
         ret = pos->next;
     }
-    free(pos);
+    STL_List_free_node(l, pos);
 
     --l->size;
+    STL_List_index_erase(l, rank);
 
     STL_List_check_pointers(l);
 
@@ -314,6 +686,58 @@ STL_List_node *STL_List_erase(STL_List *l, STL_List_node *pos)
     return ret;
 }
 
+int STL_List_insert_at(STL_List *l, const void *elem, size_t size, size_t pos)
+{
+
+    /* Main part */
+    if (l == NULL || elem == NULL) {
+        return STL_List_null_reference_error;
+    }
+
+    if (pos > l->size) {
+        return STL_List_index_error;
+    }
+
+    /* Returning value */
+    return STL_List_insert_node(l, elem, size, STL_List_node_at(l, pos), pos);
+}
+
+int STL_List_insert(STL_List *l, const void *elem, size_t size, STL_List_node *pos)
+{
+
+    /* Main part */
+    if (l == NULL || elem == NULL) {
+        return STL_List_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_List_insert_node(l, elem, size, pos, STL_List_known_rank(l, pos));
+}
+
+STL_List_node *STL_List_erase_at(STL_List *l, size_t pos)
+{
+
+    /* Main part */
+    if (l == NULL || pos >= l->size) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_List_erase_node(l, STL_List_node_at(l, pos), pos);
+}
+
+STL_List_node *STL_List_erase(STL_List *l, STL_List_node *pos)
+{
+
+    /* Main part */
+    if (l == NULL) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_List_erase_node(l, pos, STL_List_known_rank(l, pos));
+}
+
 int STL_List_push_back(STL_List *l, const void *elem, size_t size)
 {
 
@@ -346,73 +770,357 @@ void STL_List_merge(STL_List *self, STL_List *other, int (*cmp)(const void *, co
 {
 
     /* Initializing variables */
-    auto STL_List_node *i1, *i2;
+    auto STL_List_node *chain;
 
     /* VarCheck */
-    if (self == NULL || other == NULL || STL_List_empty(other)) {
+    if (self == NULL || other == NULL || self == other || cmp == NULL || STL_List_empty(other)) {
         return;
     }
 
     /* Main part */
+    /* The nodes of "other" move over together with the slabs they live in */
     if (!STL_List_empty(self)) {
-        for (i1 = STL_List_begin(self), i2 = STL_List_begin(other);
-             i1 != STL_List_end(self) && i2 != STL_List_end(other); ) {
-            if (cmp(i1->value, i2->value) < 0) {
-                i1 = i1->next;
-            } else {
-                STL_List_insert(self, i2->value, i2->size, i1);
-                i2 = STL_List_erase(other, i2);
-            };
+        STL_List_last(self)->next = NULL;
+    }
+    STL_List_last(other)->next = NULL;
+
+    chain = (STL_List_empty(self)) ? other->bp : STL_List_merge_chains(self->bp, other->bp, cmp);
+    STL_List_link_chain(self, chain, STL_List_end(self));
+    self->size += other->size;
+    STL_List_index_stale(self);
+    STL_List_index_stale(other);
+
+    __STL_Pool_adopt(&self->pool, &other->pool);
+    other->bp = other->lp;
+    other->lp->prev = NULL;
+    other->size = 0;
+}
+
+int STL_List_splice(STL_List *self, STL_List_node *pos, STL_List *other)
+{
+
+    /* Initializing variables */
+    auto STL_List_node *first, *last;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL) {
+        return STL_List_null_reference_error;
+    }
+
+    /* Main part */
+    if (self == other || STL_List_empty(other)) {
+        return STL_List_OK;
+    }
+
+    /* The nodes of "other" move over together with the slabs they live in */
+    first = STL_List_begin(other);
+    last = STL_List_last(other);
+    STL_List_unlink(other, first, last);
+    STL_List_relink(self, pos, first, last);
+
+    self->size += other->size;
+    other->size = 0;
+    __STL_Pool_adopt(&self->pool, &other->pool);
+    STL_List_index_stale(self);
+    STL_List_index_stale(other);
+
+    /* Returning value */
+    return STL_List_OK;
+}
+
+int STL_List_splice_node(STL_List *self, STL_List_node *pos, STL_List *other, STL_List_node *node)
+{
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL || node == NULL) {
+        return STL_List_null_reference_error;
+    }
+
+    if (node->value == NULL) {
+        return STL_List_index_error;
+    }
+
+    /* Main part */
+    if (node == pos || node->next == pos) {
+        return STL_List_OK;
+    }
+
+    /* A moved node goes back to the slab it lives in when freed, and keeps that slab alive until then */
+    if (self != other) {
+        if (!__STL_Pool_share(&self->pool, &other->pool)) {
+            return STL_List_memory_error;
+        }
+        __STL_Pool_move(&self->pool, &other->pool, node_header + node->size);
+
+        ++self->size;
+        --other->size;
+    }
+
+    STL_List_unlink(other, node, node);
+    STL_List_relink(self, pos, node, node);
+    STL_List_index_stale(self);
+    STL_List_index_stale(other);
+
+    /* Returning value */
+    return STL_List_OK;
+}
+
+int STL_List_splice_range(STL_List *self, STL_List_node *pos, STL_List *other, STL_List_node *first,
+                          STL_List_node *last)
+{
+
+    /* Initializing variables */
+    register STL_List_node *iter;
+    register size_t n;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL || pos == NULL || first == NULL || last == NULL) {
+        return STL_List_null_reference_error;
+    }
+
+    /* Main part */
+    if (first == last || pos == first) {
+        return STL_List_OK;
+    }
+
+    for (iter = first, n = 0; iter != last; iter = iter->next, ++n) {
+        if (iter == STL_List_end(other)) {
+            return STL_List_index_error;
         }
+    }
 
-        if (!STL_List_empty(other)) {
-            goto case_2;
+    if (self != other) {
+        if (!__STL_Pool_share(&self->pool, &other->pool)) {
+            return STL_List_memory_error;
         }
-    } else {
-        case_2:
-        for (i2 = STL_List_begin(other); i2 != STL_List_end(other); i2 = STL_List_erase(other, i2)) {
-            STL_List_push_back(self, i2->value, i2->size);
+        if (other->pool.nlarge) {
+            for (iter = first; iter != last; iter = iter->next) {
+                __STL_Pool_move(&self->pool, &other->pool, node_header + iter->size);
+            }
         }
+
+        self->size += n;
+        other->size -= n;
     }
 
+    iter = last->prev;
+    STL_List_unlink(other, first, iter);
+    STL_List_relink(self, pos, first, iter);
+    STL_List_index_stale(self);
+    STL_List_index_stale(other);
+
+    /* Returning value */
+    return STL_List_OK;
+}
+
+size_t STL_List_remove_if(STL_List *l, int (*pred)(const void *, void *), void *arg)
+{
+
+    /* Initializing variables */
+    register STL_List_node *iter, *next;
+    auto size_t n = 0;
+
+    /* VarCheck */
+    if (l == NULL || pred == NULL) {
+        return 0;
+    }
+
+    /* Main part */
+    for (iter = STL_List_begin(l); iter != STL_List_end(l); iter = next) {
+        next = iter->next;
+        if (pred(iter->value, arg)) {
+            STL_List_unlink(l, iter, iter);
+            STL_List_free_node(l, iter);
+            ++n;
+        }
+    }
+
+    l->size -= n;
+    if (n) {
+        STL_List_index_stale(l);
+    }
+
+    /* Returning value */
+    return n;
+}
+
+size_t STL_List_unique(STL_List *l, int (*cmp)(const void *, const void *))
+{
+
+    /* Initializing variables */
+    register STL_List_node *iter, *next;
+    auto size_t n = 0;
+
+    /* VarCheck */
+    if (l == NULL || cmp == NULL || STL_List_empty(l)) {
+        return 0;
+    }
+
+    /* Main part */
+    /* Every element is compared with the first one of its group, which is kept */
+    for (iter = STL_List_begin(l); (next = iter->next) != STL_List_end(l);) {
+        if (!cmp(iter->value, next->value)) {
+            STL_List_unlink(l, next, next);
+            STL_List_free_node(l, next);
+            ++n;
+        } else {
+            iter = next;
+        }
+    }
+
+    l->size -= n;
+    if (n) {
+        STL_List_index_stale(l);
+    }
+
+    /* Returning value */
+    return n;
+}
+
+STL_List_node *STL_List_partition(STL_List *l, int (*pred)(const void *, void *), void *arg)
+{
+
+    /* Initializing variables */
+    register STL_List_node *iter, *next;
+    auto STL_List_node *head = NULL, *tail = NULL;
+
+    /* VarCheck */
+    if (l == NULL || pred == NULL) {
+        return NULL;
+    }
+
+    /* Main part */
+    /* Nodes that fail "pred" are collected in order and put back at the end */
+    for (iter = STL_List_begin(l); iter != STL_List_end(l); iter = next) {
+        next = iter->next;
+        if (!pred(iter->value, arg)) {
+            STL_List_unlink(l, iter, iter);
+            iter->prev = tail;
+            if (tail != NULL) {
+                tail->next = iter;
+            } else {
+                head = iter;
+            }
+            tail = iter;
+        }
+    }
+
+    if (head == NULL) {
+        return STL_List_end(l);
+    }
+
+    STL_List_relink(l, STL_List_end(l), head, tail);
+    STL_List_index_stale(l);
+
+    /* Returning value */
+    return head;
 }
 
 void STL_List_reverse(STL_List *self)
 {
 
     /* Initializing variables */
-    auto STL_List_node *iter, *iter_b;
-    register size_t i;
+    auto STL_List_node *iter, *next, *first, *last;
+
+    /* VarCheck */
+    if (self == NULL || self->size < 2) {
+        return;
+    }
 
     /* Main part */
-    for (i = 0, iter = STL_List_begin(self), iter_b = STL_List_end(self)->prev; i < STL_List_size(self) / 2;
-         iter = iter->next, iter_b = iter_b->prev, ++i) {
-        STL_List_swap_nodes(iter, iter_b);
+    /* Nodes are relinked, so elements of any size stay where they are */
+    first = STL_List_begin(self);
+    last = STL_List_end(self)->prev;
+    for (iter = first; iter != STL_List_end(self); iter = next) {
+        next = iter->next;
+        iter->next = iter->prev;
+        iter->prev = next;
     }
+
+    last->prev = NULL;
+    first->next = STL_List_end(self);
+    STL_List_end(self)->prev = first;
+    self->bp = last;
+    STL_List_index_stale(self);
 }
 
 void STL_List_sort(STL_List *l, size_t n, int (*cmp)(const void *, const void *))
 {
 
     /* Initializing variables */
+    auto STL_List_node *bins[sizeof(size_t) * 8], *chain, *node, *rest;
+    register size_t i;
+
+    /* VarCheck */
+    if (l == NULL || cmp == NULL) {
+        return;
+    }
+
+    /* Main part */
+    n = (n < l->size) ? n : l->size;
+    if (n < 2) {
+        return;
+    }
+
+    /* The first "n" nodes are cut off as a chain, the rest is linked back after sorting */
+    for (i = 1, rest = STL_List_begin(l); i < n; ++i) {
+        rest = rest->next;
+    }
+    chain = STL_List_begin(l);
+    node = rest;
+    rest = rest->next;
+    node->next = NULL;
+
+    /* Bottom-up: bins[i] holds a sorted run of 2^i nodes, each one older than everything in lower bins */
+    memset(bins, 0, sizeof(bins));
+    while (chain != NULL) {
+        node = chain;
+        chain = chain->next;
+        node->next = NULL;
+
+        for (i = 0; bins[i] != NULL; ++i) {
+            node = STL_List_merge_chains(bins[i], node, cmp);
+            bins[i] = NULL;
+        }
+        bins[i] = node;
+    }
+
+    for (i = 0, node = NULL; i < sizeof(bins) / sizeof(*bins); ++i) {
+        if (bins[i] != NULL) {
+            node = (node == NULL) ? bins[i] : STL_List_merge_chains(bins[i], node, cmp);
+        }
+    }
 
+    STL_List_link_chain(l, node, rest);
+    STL_List_index_stale(l);
 }
 
-void STL_List_swap_nodes(STL_List_node *a, STL_List_node *b)
+int STL_List_swap_nodes(STL_List_node *a, STL_List_node *b)
 {
 
     /* Initializing variables */
-    auto STL_List_node tmp;
+    auto unsigned char *pa, *pb, tmp;
+    register size_t i;
 
-    /* Main part */
-    tmp.value = b->value;
-    tmp.size = b->size;
+    /* VarCheck */
+    if (a == NULL || b == NULL || a->value == NULL || b->value == NULL) {
+        return STL_List_null_reference_error;
+    }
 
-    b->value = a->value;
-    b->size = a->size;
+    /* Elements live inside their nodes, so only ones of the same size can trade places */
+    if (a->size != b->size) {
+        return STL_List_index_error;
+    }
 
-    a->value = tmp.value;
-    a->size = tmp.size;
+    /* Main part */
+    for (i = 0, pa = a->value, pb = b->value; i < a->size; ++i) {
+        tmp = pa[i];
+        pa[i] = pb[i];
+        pb[i] = tmp;
+    }
+
+    /* Returning value */
+    return STL_List_OK;
 }
 
 void STL_List_swap(STL_List *self, STL_List *other)
@@ -425,14 +1133,20 @@ void STL_List_swap(STL_List *self, STL_List *other)
     tmp.bp = other->bp;
     tmp.lp = other->lp;
     tmp.size = other->size;
+    tmp.pool = other->pool;
+    tmp.index = other->index;
 
     other->bp = self->bp;
     other->lp = self->lp;
     other->size = self->size;
+    other->pool = self->pool;
+    other->index = self->index;
 
     self->bp = tmp.bp;
     self->lp = tmp.lp;
     self->size = tmp.size;
+    self->pool = tmp.pool;
+    self->index = tmp.index;
 }
 
 size_t STL_List_size_node(STL_List_node *node)
@@ -0,0 +1,599 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/__internal/__STL_Pool.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+
+/* Every chunk starts with a slab header, padded to keep the blocks aligned */
+static const size_t chunk_size = 16 * 1024;
+static const size_t slab_header = 32;
+
+static const size_t first_nblocks = 4;
+
+/* Slabs up to "mixed_max" bytes are cut out of a chunk shared by all pools, in granules. The header of such a chunk
+ * is followed by a table with the first granule of the slab every granule is in */
+static const size_t mixed_max = 4 * 1024;
+static const size_t granule = 64;
+static const size_t mixed_first = 320;
+
+static __STL_Pool_slab *mixed = NULL;
+static size_t mixed_used = 0;
+static char mixed_lock = 0;
+
+static const size_t class_sizes[__STL_POOL_NCLASSES] = {16, 32, 48, 64, 96, 128, 192, 256, 384, 512};
+
+/* Size class of every multiple of 16 up to 512 */
+static const unsigned char class_of[33] = {
+    0, 0, 1, 2, 3, 4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7,
+    8, 8, 8, 8, 8, 8, 8, 8, 9, 9, 9, 9, 9, 9, 9, 9
+};
+
+static __STL_Pool_slab *__STL_Pool_chunk_of(const void *block)
+{
+
+    /* Returning value */
+    return (__STL_Pool_slab *) ((uintptr_t) block & ~(uintptr_t) (chunk_size - 1));
+}
+
+static __STL_Pool_slab *__STL_Pool_slab_of(const void *block)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_slab *chunk = __STL_Pool_chunk_of(block);
+    auto const unsigned char *table = (const unsigned char *) chunk + slab_header;
+
+    /* Main part */
+    if (chunk->head != NULL) {
+        return chunk->head;
+    }
+
+    /* Returning value */
+    return (__STL_Pool_slab *) ((char *) chunk + table[((const char *) block - (char *) chunk) / granule] * granule);
+}
+
+static void __STL_Pool_drop_mixed(__STL_Pool_slab *chunk)
+{
+
+    /* Main part */
+    if (__atomic_sub_fetch(&chunk->live, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(chunk);
+    }
+}
+
+static __STL_Pool_slab *__STL_Pool_cut_mixed(size_t size)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_slab *slab = NULL, *full = NULL;
+    auto unsigned char *table;
+    auto void *memory;
+    register size_t i;
+
+    /* Main part */
+    size = (size + granule - 1) & ~(granule - 1);
+    while (__atomic_test_and_set(&mixed_lock, __ATOMIC_ACQUIRE))
+        ;
+
+    /* The chunk in use counts as a slab of its own, so it is not freed before the next one replaces it */
+    if (mixed == NULL || mixed_used + size > chunk_size) {
+        full = mixed;
+        mixed = NULL;
+        if (posix_memalign(&memory, chunk_size, chunk_size) == 0) {
+            mixed = memory;
+            mixed->head = NULL;
+            mixed->live = 1;
+            mixed_used = mixed_first;
+        }
+    }
+
+    if (mixed != NULL) {
+        table = (unsigned char *) mixed + slab_header;
+        for (i = mixed_used / granule; i < (mixed_used + size) / granule; ++i) {
+            table[i] = (unsigned char) (mixed_used / granule);
+        }
+        slab = (__STL_Pool_slab *) ((char *) mixed + mixed_used);
+        mixed_used += size;
+        __atomic_add_fetch(&mixed->live, 1, __ATOMIC_RELAXED);
+    }
+
+    __atomic_clear(&mixed_lock, __ATOMIC_RELEASE);
+
+    if (full != NULL) {
+        __STL_Pool_drop_mixed(full);
+    }
+
+    /* Returning value */
+    return slab;
+}
+
+static void __STL_Pool_free_slab(__STL_Pool_slab *slab)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_slab *chunk = __STL_Pool_chunk_of(slab);
+
+    /* Main part */
+    if (chunk->head == NULL) {
+        __STL_Pool_drop_mixed(chunk);
+    } else {
+        free(slab);
+    }
+}
+
+static char *__STL_Pool_add_slab(__STL_Pool *pool, size_t size)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_slab *slab;
+    auto void *memory;
+    register size_t offset;
+
+    /* Main part */
+    if (size <= mixed_max) {
+        if ((slab = __STL_Pool_cut_mixed(size)) == NULL) {
+            return NULL;
+        }
+        slab->head = slab;
+    } else {
+        if (posix_memalign(&memory, chunk_size, size) != 0) {
+            return NULL;
+        }
+
+        slab = memory;
+        for (offset = 0; offset < size; offset += chunk_size) {
+            ((__STL_Pool_slab *) ((char *) memory + offset))->head = slab;
+        }
+    }
+
+    slab->next = pool->slabs;
+    slab->home = pool->home;
+    slab->live = 0;
+    pool->slabs = slab;
+
+    /* Returning value */
+    return (char *) slab;
+}
+
+static void __STL_Pool_push_chain(__STL_Pool_class *cls, void *chain)
+{
+
+    /* Initializing variables */
+    auto void **tail;
+
+    /* Main part */
+    if (chain == NULL) {
+        return;
+    }
+
+    for (tail = &chain; *(void **) *tail != NULL; tail = (void **) *tail) {
+        ++cls->nfree;
+    }
+    ++cls->nfree;
+
+    if (cls->free == NULL) {
+        cls->last = *tail;
+    }
+    *(void **) *tail = cls->free;
+    cls->free = chain;
+}
+
+static int __STL_Pool_add_blocks(__STL_Pool *pool, __STL_Pool_class *cls, size_t block_size, size_t nblocks)
+{
+
+    /* Initializing variables */
+    auto size_t per_chunk = (chunk_size - slab_header) / block_size, nchunks;
+    auto char *slab, *block;
+    auto void *chain, **tail = &chain;
+    register size_t i;
+
+    /* Main part */
+    if (nblocks / per_chunk >= (size_t) -1 / chunk_size) {
+        return 0;
+    }
+
+    /* Blocks never cross a chunk border, so only the last chunk is cut short */
+    nchunks = (nblocks + per_chunk - 1) / per_chunk;
+    if ((slab = __STL_Pool_add_slab(
+             pool, (nchunks - 1) * chunk_size + slab_header + (nblocks - (nchunks - 1) * per_chunk) * block_size)) == NULL) {
+        return 0;
+    }
+
+    for (i = 0, block = slab + slab_header; i < nblocks; ++i, block += block_size) {
+        if (i && i % per_chunk == 0) {
+            block = slab + i / per_chunk * chunk_size + slab_header;
+        }
+        *tail = block;
+        tail = (void **) block;
+    }
+    *tail = NULL;
+
+    ((__STL_Pool_slab *) slab)->live = nblocks;
+    __STL_Pool_push_chain(cls, chain);
+
+    /* Returning value */
+    return 1;
+}
+
+static int __STL_Pool_grow(__STL_Pool *pool, __STL_Pool_class *cls, size_t count)
+{
+
+    /* Initializing variables */
+    auto size_t block_size = class_sizes[cls - pool->classes], per_chunk = (chunk_size - slab_header) / block_size;
+    auto size_t nblocks;
+
+    /* Main part */
+    /* Every slab is twice the previous one, up to a chunk, and holds "count" blocks at least */
+    nblocks = (!cls->nblocks)                    ? first_nblocks
+              : (cls->nblocks * 2 <= per_chunk) ? cls->nblocks * 2
+              : (cls->nblocks < per_chunk)      ? per_chunk
+                                                : cls->nblocks;
+    if (!__STL_Pool_add_blocks(pool, cls, block_size, (count > nblocks) ? count : nblocks)) {
+        return 0;
+    }
+
+    cls->nblocks = nblocks;
+
+    /* Returning value */
+    return 1;
+}
+
+static void __STL_Pool_set_home(__STL_Pool_slab *slab, __STL_Pool_home *home)
+{
+
+    /* Main part */
+    for (; slab != NULL; slab = slab->next) {
+        slab->home = home;
+    }
+}
+
+static void __STL_Pool_join_slabs(__STL_Pool *pool, __STL_Pool_slab *chain)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_slab **tail;
+
+    /* Main part */
+    __STL_Pool_set_home(chain, pool->home);
+
+    for (tail = &chain; *tail != NULL; tail = &(*tail)->next)
+        ;
+    *tail = pool->slabs;
+    pool->slabs = chain;
+}
+
+static int __STL_Pool_make_home(__STL_Pool *pool)
+{
+
+    /* Initializing variables */
+    register size_t i;
+
+    /* Main part */
+    if (pool->home != NULL) {
+        return 1;
+    }
+
+    if ((pool->home = malloc(sizeof(__STL_Pool_home))) == NULL) {
+        return 0;
+    }
+
+    for (i = 0; i < __STL_POOL_NCLASSES; ++i) {
+        pool->home->returned[i] = NULL;
+    }
+
+    /* Blocks of the slabs it already has may be freed by other pools from now on */
+    __STL_Pool_set_home(pool->slabs, pool->home);
+
+    /* Returning value */
+    return 1;
+}
+
+void __STL_Pool_init(__STL_Pool *pool)
+{
+
+    /* Initializing variables */
+    register size_t i;
+
+    /* Main part */
+    pool->slabs = NULL;
+    pool->nlarge = 0;
+    pool->home = NULL;
+    pool->cursor = pool->limit = NULL;
+
+    for (i = 0; i < __STL_POOL_NCLASSES; ++i) {
+        pool->classes[i].free = pool->classes[i].last = NULL;
+        pool->classes[i].nfree = 0;
+        pool->classes[i].nblocks = 0;
+    }
+}
+
+void *__STL_Pool_alloc(__STL_Pool *pool, size_t size)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_class *cls;
+    auto void *block;
+
+    /* Main part */
+    if (size > class_sizes[__STL_POOL_NCLASSES - 1]) {
+        if ((block = malloc(size)) != NULL) {
+            ++pool->nlarge;
+        }
+        return block;
+    }
+
+    cls = pool->classes + class_of[(size + 15) / 16];
+    if (cls->free == NULL && pool->home != NULL) {
+        __STL_Pool_push_chain(cls, pool->home->returned[cls - pool->classes]);
+        pool->home->returned[cls - pool->classes] = NULL;
+    }
+
+    if (cls->free == NULL && !__STL_Pool_grow(pool, cls, 1)) {
+        return NULL;
+    }
+
+    block = cls->free;
+    cls->free = *(void **) block;
+    --cls->nfree;
+
+    /* Returning value */
+    return block;
+}
+
+void __STL_Pool_free(__STL_Pool *pool, void *block, size_t size)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_class *cls;
+    auto __STL_Pool_slab *slab;
+    auto size_t i;
+
+    /* Main part */
+    if (size > class_sizes[__STL_POOL_NCLASSES - 1]) {
+        free(block);
+        --pool->nlarge;
+        return;
+    }
+
+    i = class_of[(size + 15) / 16];
+
+    /* Blocks of other pools go back home, or are dropped if their pool is gone */
+    if (pool->home != NULL && (slab = __STL_Pool_slab_of(block))->home != pool->home) {
+        if (slab->home != NULL) {
+            *(void **) block = slab->home->returned[i];
+            slab->home->returned[i] = block;
+        } else if (--slab->live == 0) {
+            __STL_Pool_free_slab(slab);
+        }
+        return;
+    }
+
+    cls = pool->classes + i;
+    if (cls->free == NULL) {
+        cls->last = block;
+    }
+    *(void **) block = cls->free;
+    cls->free = block;
+    ++cls->nfree;
+}
+
+int __STL_Pool_reserve(__STL_Pool *pool, size_t size, size_t count)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_class *cls;
+
+    /* Main part */
+    if (size > class_sizes[__STL_POOL_NCLASSES - 1]) {
+        return 1;
+    }
+
+    cls = pool->classes + class_of[(size + 15) / 16];
+    if (cls->nfree >= count) {
+        return 1;
+    }
+
+    if (!__STL_Pool_grow(pool, cls, count - cls->nfree)) {
+        return 0;
+    }
+
+    /* Returning value */
+    return 1;
+}
+
+void __STL_Pool_release(__STL_Pool *pool)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_slab *slab, *next;
+    auto void *block;
+    register size_t i;
+
+    /* Main part */
+    /* Spare blocks are dropped first: what is left live in a slab then belongs to other pools */
+    if (pool->home != NULL) {
+        for (i = 0; i < __STL_POOL_NCLASSES; ++i) {
+            for (block = pool->classes[i].free; block != NULL; block = *(void **) block) {
+                --__STL_Pool_slab_of(block)->live;
+            }
+            for (block = pool->home->returned[i]; block != NULL; block = *(void **) block) {
+                --__STL_Pool_slab_of(block)->live;
+            }
+        }
+    }
+
+    /* A slab with blocks in other pools is freed by the last of them */
+    for (slab = pool->slabs; slab != NULL; slab = next) {
+        next = slab->next;
+        if (pool->home == NULL || slab->live == 0) {
+            __STL_Pool_free_slab(slab);
+        } else {
+            slab->home = NULL;
+        }
+    }
+
+    free(pool->home);
+    __STL_Pool_init(pool);
+}
+
+void __STL_Pool_adopt(__STL_Pool *pool, __STL_Pool *other)
+{
+
+    /* Initializing variables */
+    auto __STL_Pool_class *cls, *other_cls;
+    auto void *block, *next;
+    register size_t i;
+
+    /* Main part */
+    if (pool == other) {
+        return;
+    }
+
+    /* One home is kept for both, and all slabs of "other" point to it */
+    if (other->home != NULL) {
+        if (pool->home == NULL) {
+            pool->home = other->home;
+            __STL_Pool_set_home(pool->slabs, pool->home);
+        } else {
+            for (i = 0; i < __STL_POOL_NCLASSES; ++i) {
+                for (block = other->home->returned[i]; block != NULL; block = next) {
+                    next = *(void **) block;
+                    *(void **) block = pool->home->returned[i];
+                    pool->home->returned[i] = block;
+                }
+            }
+            free(other->home);
+        }
+    }
+    __STL_Pool_join_slabs(pool, other->slabs);
+
+    for (i = 0; i < __STL_POOL_NCLASSES; ++i) {
+        cls = pool->classes + i;
+        other_cls = other->classes + i;
+        if (other_cls->free != NULL) {
+            *(void **) other_cls->last = cls->free;
+            if (cls->free == NULL) {
+                cls->last = other_cls->last;
+            }
+            cls->free = other_cls->free;
+            cls->nfree += other_cls->nfree;
+        }
+        if (other_cls->nblocks > cls->nblocks) {
+            cls->nblocks = other_cls->nblocks;
+        }
+    }
+
+    pool->nlarge += other->nlarge;
+    __STL_Pool_init(other);
+}
+
+int __STL_Pool_share(__STL_Pool *pool, __STL_Pool *other)
+{
+
+    /* Returning value */
+    return pool == other || (__STL_Pool_make_home(pool) && __STL_Pool_make_home(other));
+}
+
+void __STL_Pool_move(__STL_Pool *pool, __STL_Pool *other, size_t size)
+{
+
+    /* Main part */
+    if (size > class_sizes[__STL_POOL_NCLASSES - 1]) {
+        ++pool->nlarge;
+        --other->nlarge;
+    }
+}
+
+size_t __STL_Pool_block_size(size_t size)
+{
+
+    /* Main part */
+    if (size > class_sizes[__STL_POOL_NCLASSES - 1]) {
+        return 0;
+    }
+
+    /* Returning value */
+    return class_sizes[class_of[(size + 15) / 16]];
+}
+
+int __STL_Pool_adjacent(const void *block, size_t size, const void *next)
+{
+
+    /* Initializing variables */
+    auto const char *end = (const char *) block + __STL_Pool_block_size(size);
+
+    /* Main part */
+    if (next == end) {
+        return 1;
+    }
+
+    /* The rest of a chunk too short for the block is skipped, along with the header of the next one */
+    return (char *) __STL_Pool_chunk_of(next) == (char *) __STL_Pool_chunk_of(block) + chunk_size &&
+           (const char *) next == (char *) __STL_Pool_chunk_of(next) + slab_header;
+}
+
+int __STL_Pool_run(__STL_Pool *pool, size_t nbytes)
+{
+
+    /* Initializing variables */
+    auto size_t per_chunk = chunk_size - slab_header - (class_sizes[__STL_POOL_NCLASSES - 1] - 16), size;
+    auto char *slab;
+
+    /* Main part */
+    if (nbytes <= chunk_size - slab_header) {
+        size = slab_header + nbytes;
+    } else if (nbytes / per_chunk < (size_t) -1 / chunk_size - 1) {
+        size = (nbytes / per_chunk + 1) * chunk_size;
+    } else {
+        return 0;
+    }
+
+    if ((slab = __STL_Pool_add_slab(pool, size)) == NULL) {
+        return 0;
+    }
+
+    pool->cursor = slab + slab_header;
+    pool->limit = slab + ((size < chunk_size) ? size : chunk_size);
+
+    /* Returning value */
+    return 1;
+}
+
+void *__STL_Pool_run_alloc(__STL_Pool *pool, size_t size)
+{
+
+    /* Initializing variables */
+    auto size_t block_size = __STL_Pool_block_size(size);
+    auto char *block;
+
+    /* Main part */
+    if (pool->cursor + block_size > pool->limit) {
+        pool->cursor = pool->limit + slab_header;
+        pool->limit += chunk_size;
+    }
+
+    block = pool->cursor;
+    pool->cursor += block_size;
+    ++__STL_Pool_slab_of(block)->live;
+
+    /* Returning value */
+    return block;
+}
@@ -70,6 +70,13 @@ size_t STL_Queue_size(const STL_Queue *queue)
     return STL_List_size((STL_List *) queue);
 }
 
+int STL_Queue_reserve(STL_Queue *self, size_t n, size_t nbytes)
+{
+
+    /* Returning value */
+    return STL_List_reserve((STL_List *) self, n, nbytes);
+}
+
 int STL_Queue_push(STL_Queue *self, const void *elem, size_t nbytes)
 {
 
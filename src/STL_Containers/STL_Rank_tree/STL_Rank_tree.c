@@ -0,0 +1,468 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/__internal/__STL_Rank_tree.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Most children or items of a node */
+#define __STL_RANK_TREE_ORDER 64
+
+/* Every node but the root keeps at least "min_fill" - 1 of them. Built nodes start "build_fill" full */
+static const size_t min_fill = __STL_RANK_TREE_ORDER / 4;
+static const size_t build_fill = __STL_RANK_TREE_ORDER * 3 / 4;
+
+/* Definition of __STL_Rank_tree_node */
+typedef struct __STL_Rank_tree_node {
+    size_t n;
+    int leaf;
+    size_t counts[__STL_RANK_TREE_ORDER]; /* Items under each child. Unused in leaves */
+    void *slots[__STL_RANK_TREE_ORDER];   /* Children, or items in leaves */
+} __STL_Rank_tree_node;
+
+static void __STL_Rank_tree_free_node(__STL_Rank_tree_node *node)
+{
+
+    /* Initializing variables */
+    register size_t i;
+
+    /* Main part */
+    if (node == NULL) {
+        return;
+    }
+
+    if (!node->leaf) {
+        for (i = 0; i < node->n; ++i) {
+            __STL_Rank_tree_free_node(node->slots[i]);
+        }
+    }
+
+    free(node);
+}
+
+static int __STL_Rank_tree_reserve(__STL_Rank_tree *tree, size_t count)
+{
+
+    /* Initializing variables */
+    auto __STL_Rank_tree_node *node;
+
+    /* Main part */
+    while (tree->nspare < count) {
+        if ((node = malloc(sizeof(__STL_Rank_tree_node))) == NULL) {
+            return 0;
+        }
+
+        node->slots[0] = tree->spare;
+        tree->spare = node;
+        ++tree->nspare;
+    }
+
+    /* Returning value */
+    return 1;
+}
+
+static __STL_Rank_tree_node *__STL_Rank_tree_take(__STL_Rank_tree *tree, int leaf)
+{
+
+    /* Initializing variables */
+    auto __STL_Rank_tree_node *node;
+
+    /* Main part */
+    node = tree->spare;
+    tree->spare = node->slots[0];
+    --tree->nspare;
+
+    node->n = 0;
+    node->leaf = leaf;
+
+    /* Returning value */
+    return node;
+}
+
+static void __STL_Rank_tree_give_back(__STL_Rank_tree *tree, __STL_Rank_tree_node *node)
+{
+
+    /* Main part */
+    /* Enough is kept for the next insertion, even if the tree grows a level */
+    if (tree->nspare > tree->height + 1) {
+        free(node);
+        return;
+    }
+
+    node->slots[0] = tree->spare;
+    tree->spare = node;
+    ++tree->nspare;
+}
+
+static size_t __STL_Rank_tree_total(const __STL_Rank_tree_node *node)
+{
+
+    /* Initializing variables */
+    register size_t i, total;
+
+    /* Main part */
+    if (node->leaf) {
+        return node->n;
+    }
+
+    for (i = total = 0; i < node->n; ++i) {
+        total += node->counts[i];
+    }
+
+    /* Returning value */
+    return total;
+}
+
+static void __STL_Rank_tree_move(__STL_Rank_tree_node *dest, size_t dest_pos, __STL_Rank_tree_node *src,
+                                 size_t src_pos, size_t count)
+{
+
+    /* Copies "count" slots and their counts. Ranges may not overlap */
+
+    /* Main part */
+    memcpy(dest->slots + dest_pos, src->slots + src_pos, count * sizeof(*src->slots));
+    if (!src->leaf) {
+        memcpy(dest->counts + dest_pos, src->counts + src_pos, count * sizeof(*src->counts));
+    }
+}
+
+static void __STL_Rank_tree_shift(__STL_Rank_tree_node *node, size_t pos, size_t count, int right)
+{
+
+    /* Makes room for "count" slots at "pos", or closes a gap of "count" slots at "pos" */
+
+    /* Initializing variables */
+    auto size_t from = (right) ? pos : pos + count, to = (right) ? pos + count : pos;
+
+    /* Main part */
+    memmove(node->slots + to, node->slots + from, (node->n - pos - ((right) ? 0 : count)) * sizeof(*node->slots));
+    if (!node->leaf) {
+        memmove(node->counts + to, node->counts + from,
+                (node->n - pos - ((right) ? 0 : count)) * sizeof(*node->counts));
+    }
+}
+
+static void __STL_Rank_tree_split_child(__STL_Rank_tree *tree, __STL_Rank_tree_node *node, size_t i)
+{
+
+    /* Moves the upper half of a full child into a new node after it */
+
+    /* Initializing variables */
+    auto __STL_Rank_tree_node *child = node->slots[i], *sibling;
+    auto size_t half = __STL_RANK_TREE_ORDER / 2;
+
+    /* Main part */
+    sibling = __STL_Rank_tree_take(tree, child->leaf);
+    __STL_Rank_tree_move(sibling, 0, child, half, child->n - half);
+    sibling->n = child->n - half;
+    child->n = half;
+
+    __STL_Rank_tree_shift(node, i + 1, 1, 1);
+    ++node->n;
+    node->slots[i + 1] = sibling;
+    node->counts[i + 1] = __STL_Rank_tree_total(sibling);
+    node->counts[i] -= node->counts[i + 1];
+}
+
+static size_t __STL_Rank_tree_fix_child(__STL_Rank_tree *tree, __STL_Rank_tree_node *node, size_t i, size_t *rank)
+{
+
+    /* Fills a child that is about to lose a slot from a neighbour. Returns the new index of the child */
+
+    /* Initializing variables */
+    auto size_t left = (i + 1 < node->n) ? i : i - 1, k, moved, j;
+    auto __STL_Rank_tree_node *l = node->slots[left], *r = node->slots[left + 1];
+
+    /* Main part */
+    if (l->n + r->n <= __STL_RANK_TREE_ORDER) {
+        /* Both fit into the left one */
+        __STL_Rank_tree_move(l, l->n, r, 0, r->n);
+        l->n += r->n;
+
+        if (i != left) {
+            *rank += node->counts[left];
+        }
+        node->counts[left] += node->counts[left + 1];
+
+        __STL_Rank_tree_shift(node, left + 1, 1, 0);
+        --node->n;
+        __STL_Rank_tree_give_back(tree, r);
+
+        return left;
+    }
+
+    if (i == left) {
+        /* The front of the right neighbour goes to the end of the child */
+        k = (r->n - l->n) / 2;
+        __STL_Rank_tree_move(l, l->n, r, 0, k);
+        __STL_Rank_tree_shift(r, 0, k, 0);
+        for (j = 0, moved = (l->leaf) ? k : 0; !l->leaf && j < k; ++j) {
+            moved += l->counts[l->n + j];
+        }
+        l->n += k;
+        r->n -= k;
+
+        node->counts[left] += moved;
+        node->counts[left + 1] -= moved;
+    } else {
+        /* The end of the left neighbour goes to the front of the child */
+        k = (l->n - r->n) / 2;
+        __STL_Rank_tree_shift(r, 0, k, 1);
+        __STL_Rank_tree_move(r, 0, l, l->n - k, k);
+        for (j = 0, moved = (r->leaf) ? k : 0; !r->leaf && j < k; ++j) {
+            moved += r->counts[j];
+        }
+        l->n -= k;
+        r->n += k;
+
+        node->counts[left] -= moved;
+        node->counts[left + 1] += moved;
+        *rank += moved;
+    }
+
+    /* Returning value */
+    return i;
+}
+
+void __STL_Rank_tree_init(__STL_Rank_tree *tree)
+{
+
+    /* Main part */
+    tree->root = tree->spare = NULL;
+    tree->nspare = tree->height = tree->size = 0;
+    tree->stale = 0;
+}
+
+void __STL_Rank_tree_clear(__STL_Rank_tree *tree)
+{
+
+    /* Initializing variables */
+    auto __STL_Rank_tree_node *node;
+
+    /* Main part */
+    __STL_Rank_tree_free_node(tree->root);
+    while ((node = tree->spare) != NULL) {
+        tree->spare = node->slots[0];
+        free(node);
+    }
+
+    __STL_Rank_tree_init(tree);
+}
+
+int __STL_Rank_tree_build(__STL_Rank_tree *tree, void **items, size_t n)
+{
+
+    /* Initializing variables */
+    auto __STL_Rank_tree_node **level, *node;
+    auto size_t nnodes, ngroups, group, extra, i, j, k, height;
+
+    /* Main part */
+    __STL_Rank_tree_clear(tree);
+    if (!n) {
+        return 1;
+    }
+
+    nnodes = (n + build_fill - 1) / build_fill;
+    if ((level = malloc(nnodes * sizeof(*level))) == NULL) {
+        return 0;
+    }
+
+    /* Every level is split evenly, so no node ends up with just a few slots */
+    for (height = 1, ngroups = nnodes, nnodes = n; ; ++height) {
+        group = nnodes / ngroups;
+        extra = nnodes % ngroups;
+
+        for (i = j = 0; i < ngroups; ++i) {
+            if ((node = malloc(sizeof(__STL_Rank_tree_node))) == NULL) {
+                break;
+            }
+            node->leaf = (height == 1);
+            node->n = group + (i < extra);
+
+            for (k = 0; k < node->n; ++k, ++j) {
+                if (node->leaf) {
+                    node->slots[k] = items[j];
+                } else {
+                    node->slots[k] = level[j];
+                    node->counts[k] = __STL_Rank_tree_total(level[j]);
+                }
+            }
+
+            /* Nodes of this level take the place of the ones they are made of */
+            level[i] = node;
+        }
+
+        if (i != ngroups) {
+            /* The new nodes own everything before "j", the rest is still on its own */
+            for (k = 0; k < i; ++k) {
+                __STL_Rank_tree_free_node(level[k]);
+            }
+            for (k = j; height > 1 && k < nnodes; ++k) {
+                __STL_Rank_tree_free_node(level[k]);
+            }
+            free(level);
+            return 0;
+        }
+
+        if (ngroups == 1) {
+            break;
+        }
+
+        nnodes = ngroups;
+        ngroups = (nnodes + build_fill - 1) / build_fill;
+    }
+
+    tree->root = level[0];
+    tree->height = height;
+    tree->size = n;
+    free(level);
+
+    /* Returning value */
+    return 1;
+}
+
+void *__STL_Rank_tree_at(const __STL_Rank_tree *tree, size_t rank)
+{
+
+    /* Initializing variables */
+    register const __STL_Rank_tree_node *node;
+    register size_t i;
+
+    /* VarCheck */
+    if (rank >= tree->size) {
+        return NULL;
+    }
+
+    /* Main part */
+    for (node = tree->root; !node->leaf; node = node->slots[i]) {
+        for (i = 0; rank >= node->counts[i]; ++i) {
+            rank -= node->counts[i];
+        }
+    }
+
+    /* Returning value */
+    return node->slots[rank];
+}
+
+int __STL_Rank_tree_insert(__STL_Rank_tree *tree, size_t rank, void *item)
+{
+
+    /* Initializing variables */
+    auto __STL_Rank_tree_node *node;
+    register size_t i;
+
+    /* VarCheck */
+    if (rank > tree->size) {
+        return 0;
+    }
+
+    /* Main part */
+    /* Full nodes are split on the way down, so every level and a new root may need one */
+    if (!__STL_Rank_tree_reserve(tree, tree->height + 1)) {
+        return 0;
+    }
+
+    if (tree->root == NULL) {
+        tree->root = __STL_Rank_tree_take(tree, 1);
+        tree->height = 1;
+    } else if (tree->root->n == __STL_RANK_TREE_ORDER) {
+        node = __STL_Rank_tree_take(tree, 0);
+        node->n = 1;
+        node->slots[0] = tree->root;
+        node->counts[0] = tree->size;
+        tree->root = node;
+        ++tree->height;
+        __STL_Rank_tree_split_child(tree, node, 0);
+    }
+
+    for (node = tree->root; !node->leaf; node = node->slots[i]) {
+        for (i = 0; i + 1 < node->n && rank > node->counts[i]; ++i) {
+            rank -= node->counts[i];
+        }
+
+        if (((__STL_Rank_tree_node *) node->slots[i])->n == __STL_RANK_TREE_ORDER) {
+            __STL_Rank_tree_split_child(tree, node, i);
+            if (rank > node->counts[i]) {
+                rank -= node->counts[i];
+                ++i;
+            }
+        }
+
+        ++node->counts[i];
+    }
+
+    __STL_Rank_tree_shift(node, rank, 1, 1);
+    node->slots[rank] = item;
+    ++node->n;
+    ++tree->size;
+
+    /* Returning value */
+    return 1;
+}
+
+void *__STL_Rank_tree_erase(__STL_Rank_tree *tree, size_t rank)
+{
+
+    /* Initializing variables */
+    auto __STL_Rank_tree_node *node;
+    auto void *item;
+    register size_t i;
+
+    /* VarCheck */
+    if (rank >= tree->size) {
+        return NULL;
+    }
+
+    /* Main part */
+    /* Children that could drop below the minimum are filled up on the way down */
+    for (node = tree->root; !node->leaf; node = node->slots[i]) {
+        for (i = 0; rank >= node->counts[i]; ++i) {
+            rank -= node->counts[i];
+        }
+
+        if (((__STL_Rank_tree_node *) node->slots[i])->n < min_fill) {
+            i = __STL_Rank_tree_fix_child(tree, node, i, &rank);
+        }
+
+        --node->counts[i];
+    }
+
+    item = node->slots[rank];
+    __STL_Rank_tree_shift(node, rank, 1, 0);
+    --node->n;
+    --tree->size;
+
+    while (!tree->root->leaf && tree->root->n == 1) {
+        node = tree->root;
+        tree->root = node->slots[0];
+        --tree->height;
+        __STL_Rank_tree_give_back(tree, node);
+    }
+
+    if (!tree->root->n) {
+        __STL_Rank_tree_give_back(tree, tree->root);
+        tree->root = NULL;
+        tree->height = 0;
+    }
+
+    /* Returning value */
+    return item;
+}
@@ -21,65 +21,309 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 #include "../../STL_Headers/STL/STL_Stack.h"
 #include "../../STL_Headers/STL/STL_List.h"
 
+#include <stdlib.h>
+#include <string.h>
+
+static void STL_Stack_set_top(STL_Stack *self)
+{
+
+    /* Main part */
+    self->top = (self->nelem) ? self->data + (self->nelem - 1) * self->nbytes : NULL;
+}
+
+static int STL_Stack_grow(STL_Stack *self, size_t n)
+{
+
+    /* Makes room for "n" elements in a vector-backed stack, moving out of the inline block if needed */
+
+    /* Initializing variables */
+    auto size_t max_nelem;
+    auto char *data;
+
+    /* Main part */
+    if (n <= self->max_nelem) {
+        return 1;
+    }
+
+    if (n > (size_t) -1 / self->nbytes) {
+        return 0;
+    }
+
+    max_nelem = (self->max_nelem <= (size_t) -1 / self->nbytes / 2) ? self->max_nelem * 2 : n;
+    max_nelem = (max_nelem > n) ? max_nelem : n;
+    if (self->data == self->inline_block.bytes) {
+        if ((data = malloc(max_nelem * self->nbytes)) == NULL) {
+            return 0;
+        }
+        memcpy(data, self->data, self->nelem * self->nbytes);
+    } else if ((data = realloc(self->data, max_nelem * self->nbytes)) == NULL) {
+        return 0;
+    }
+
+    self->data = data;
+    self->max_nelem = max_nelem;
+    STL_Stack_set_top(self);
+
+    /* Returning value */
+    return 1;
+}
+
 int STL_Stack_init(STL_Stack *self)
 {
 
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_Stack_null_reference_error;
+    }
+
+    /* Main part */
+    self->data = self->top = NULL;
+    self->nbytes = self->nelem = self->max_nelem = 0;
+
+    /* Returning value */
+    return STL_List_init(&self->list);
+}
+
+int STL_Stack_init_vector(STL_Stack *self, size_t nbytes)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_Stack_null_reference_error;
+    }
+
+    if (!nbytes) {
+        return STL_Stack_index_error;
+    }
+
+    /* Main part */
+    self->data = self->inline_block.bytes;
+    self->top = NULL;
+    self->nbytes = nbytes;
+    self->nelem = 0;
+    self->max_nelem = STL_STACK_INLINE_BYTES / nbytes;
+
     /* Returning value */
-    return STL_List_init((STL_List *) self);
+    return STL_Stack_OK;
 }
 
 int STL_Stack_init_cpy(STL_Stack *self, STL_Stack *other)
 {
 
+    /* Initializing variables */
+    auto int code;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL) {
+        return STL_Stack_null_reference_error;
+    }
+
+    /* Main part */
+    if (!other->nbytes) {
+        self->data = self->top = NULL;
+        self->nbytes = self->nelem = self->max_nelem = 0;
+        return STL_List_init_cpy(&self->list, &other->list);
+    }
+
+    if ((code = STL_Stack_init_vector(self, other->nbytes)) != STL_Stack_OK) {
+        return code;
+    }
+
+    if (!STL_Stack_grow(self, other->nelem)) {
+        return STL_Stack_memory_error;
+    }
+
+    memcpy(self->data, other->data, other->nelem * other->nbytes);
+    self->nelem = other->nelem;
+    STL_Stack_set_top(self);
+
     /* Returning value */
-    return STL_List_init_cpy((STL_List *) self, (STL_List *) other);
+    return STL_Stack_OK;
 }
 
 void STL_Stack_delete(STL_Stack *self)
 {
 
     /* Main part */
-    STL_List_delete((STL_List *) self);
+    if (self == NULL) {
+        return;
+    }
+
+    if (!self->nbytes) {
+        STL_List_delete(&self->list);
+        return;
+    }
+
+    if (self->data != self->inline_block.bytes) {
+        free(self->data);
+    }
+    STL_Stack_init_vector(self, self->nbytes);
 }
 
 void *STL_Stack_top(const STL_Stack *stack)
 {
 
+    /* VarCheck */
+    if (stack == NULL) {
+        return NULL;
+    }
+
     /* Returning value */
-    return STL_List_back((STL_List *) stack);
+    return (stack->nbytes) ? stack->top : STL_List_back(&stack->list);
 }
 
 int STL_Stack_empty(const STL_Stack *stack)
 {
 
+    /* VarCheck */
+    if (stack == NULL) {
+        return stack_is_empty;
+    }
+
     /* Returning value */
-    return STL_List_empty((STL_List *) stack);
+    return (stack->nbytes) ? ((stack->nelem) ? stack_not_empty : stack_is_empty)
+                           : STL_List_empty((STL_List *) &stack->list);
 }
 
 size_t STL_Stack_size(const STL_Stack *stack)
 {
 
+    /* VarCheck */
+    if (stack == NULL) {
+        return 0;
+    }
+
     /* Returning value */
-    return STL_List_size((STL_List *) stack);
+    return (stack->nbytes) ? stack->nelem : STL_List_size((STL_List *) &stack->list);
+}
+
+int STL_Stack_reserve(STL_Stack *self, size_t n, size_t nbytes)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_Stack_null_reference_error;
+    }
+
+    /* Main part */
+    if (!self->nbytes) {
+        return STL_List_reserve(&self->list, n, nbytes);
+    }
+
+    if (nbytes != self->nbytes) {
+        return STL_Stack_index_error;
+    }
+
+    if (!STL_Stack_grow(self, n)) {
+        return STL_Stack_memory_error;
+    }
+
+    /* Returning value */
+    return STL_Stack_OK;
 }
 
 int STL_Stack_push(STL_Stack *self, const void *elem, size_t nbytes)
 {
 
     /* Returning value */
-    return STL_List_push_back((STL_List *) self, elem, nbytes);
+    return STL_Stack_push_n(self, elem, 1, nbytes);
+}
+
+int STL_Stack_push_n(STL_Stack *self, const void *elems, size_t n, size_t nbytes)
+{
+
+    /* Initializing variables */
+    register size_t i;
+    auto int code;
+
+    /* VarCheck */
+    if (self == NULL || elems == NULL) {
+        return STL_Stack_null_reference_error;
+    }
+
+    /* Main part */
+    if (!self->nbytes) {
+        /* A single element goes the way of push_back, the pool grows its slabs by itself */
+        if (n > 1) {
+            STL_List_reserve(&self->list, n, nbytes);
+        }
+        for (i = 0; i < n; ++i) {
+            if ((code = STL_List_push_back(&self->list, (const char *) elems + i * nbytes, nbytes)) != STL_List_OK) {
+                STL_Stack_pop_n(self, i);
+                return code;
+            }
+        }
+        return STL_Stack_OK;
+    }
+
+    if (nbytes != self->nbytes) {
+        return STL_Stack_index_error;
+    }
+
+    if (n > (size_t) -1 - self->nelem || !STL_Stack_grow(self, self->nelem + n)) {
+        return STL_Stack_memory_error;
+    }
+
+    memcpy(self->data + self->nelem * self->nbytes, elems, n * self->nbytes);
+    self->nelem += n;
+    STL_Stack_set_top(self);
+
+    /* Returning value */
+    return STL_Stack_OK;
 }
 
 void STL_Stack_pop(STL_Stack *self)
 {
 
     /* Main part */
-    STL_List_pop_back((STL_List *) self);
+    STL_Stack_pop_n(self, 1);
+}
+
+void STL_Stack_pop_n(STL_Stack *self, size_t n)
+{
+
+    /* Main part */
+    if (self == NULL) {
+        return;
+    }
+
+    if (!self->nbytes) {
+        for (; n && !STL_List_empty(&self->list); --n) {
+            STL_List_pop_back(&self->list);
+        }
+        return;
+    }
+
+    self->nelem -= (n < self->nelem) ? n : self->nelem;
+    STL_Stack_set_top(self);
 }
 
 void STL_Stack_swap(STL_Stack *self, STL_Stack *other)
 {
 
+    /* Initializing variables */
+    auto STL_Stack tmp;
+    auto int self_inline, other_inline;
+
     /* Main part */
-    STL_List_swap((STL_List *) self, (STL_List *) other);
-}
\ No newline at end of file
+    self_inline = (self->data == self->inline_block.bytes);
+    other_inline = (other->data == other->inline_block.bytes);
+
+    tmp = *other;
+    *other = *self;
+    *self = tmp;
+
+    /* Inline elements were copied along, but pointers to them still point at the old place */
+    if (other_inline) {
+        self->data = self->inline_block.bytes;
+    }
+    if (self_inline) {
+        other->data = other->inline_block.bytes;
+    }
+    if (self->nbytes) {
+        STL_Stack_set_top(self);
+    }
+    if (other->nbytes) {
+        STL_Stack_set_top(other);
+    }
+}
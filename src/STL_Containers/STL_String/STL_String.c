@@ -19,6 +19,8 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 */
 
 #include "../../STL_Headers/STL/STL_String.h"
+#include "../../STL_Headers/STL/STL_String_view.h"
+#include "STL_String_internal.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -28,6 +30,7 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 #endif
 
 static const size_t thresh = 16;
+static const size_t shared_header = 16; /* Room for the reference count, keeping the characters 16-byte aligned */
 static const size_t npos = -1;
 
 enum yn {
@@ -35,16 +38,52 @@ enum yn {
     YES
 };
 
+static void STL_String_release(STL_String *self)
+{
+
+    /* Drops the hold of "self" on its buffer. The last holder of a shared buffer frees it */
+
+    /* Main part */
+    if (self->refs == NULL) {
+        free(self->data);
+    } else if (__atomic_sub_fetch(self->refs, 1, __ATOMIC_ACQ_REL) == 0) {
+        free(self->refs);
+    }
+
+    self->data = NULL;
+    self->refs = NULL;
+}
+
 static int STL_String_allocate_size(STL_String *self, size_t nchar, enum yn prev)
 {
 
+    /* Initializing variables */
+    auto void *tmp;
+
     /* Main part */
-    if (prev == YES) {
-        if ((self->data = realloc(self->data, nchar)) == NULL) {
+    if (prev == YES && self->refs != NULL && __atomic_load_n(self->refs, __ATOMIC_ACQUIRE) > 1) {
+        /* Other strings still read the shared buffer, so "self" moves to a private one */
+        if ((tmp = malloc(nchar)) == NULL) {
+            return STL_String_memory_error;
+        }
+        memcpy(tmp, self->data, min(nchar, (self->nchar + 1) * self->charWidth));
+        STL_String_release(self);
+        self->data = tmp;
+    } else if (prev == YES && self->refs != NULL) {
+        if ((tmp = realloc(self->refs, shared_header + nchar)) == NULL) {
+            return STL_String_memory_error;
+        }
+        self->refs = tmp;
+        self->data = (char *) tmp + shared_header;
+    } else if (prev == YES) {
+        if ((tmp = realloc(self->data, nchar)) == NULL) {
             return STL_String_memory_error;
         }
+        self->data = tmp;
     } else if ((self->data = calloc(nchar, sizeof(char))) == NULL) {
         return STL_String_memory_error;
+    } else {
+        self->refs = NULL;
     }
 
     /* Returning value */
@@ -52,35 +91,82 @@ static int STL_String_allocate_size(STL_String *self, size_t nchar, enum yn prev
 }
 
 static int STL_String_reallocate(STL_String *self, size_t new_size)
+{
+
+    /* Main part */
+    if (STL_String_allocate_size(self, new_size, YES) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    self->max_nchar = new_size / self->charWidth;
+    self->nchar = (self->nchar >= self->max_nchar) ? self->max_nchar - 1 : self->nchar;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int __STL_String_grow(STL_String *self, size_t nchar)
 {
 
     /* Initializing variables */
-    auto void *tmp = malloc(self->nchar * self->charWidth);
+    auto size_t new_max = self->max_nchar;
 
     /* Main part */
-    if (tmp == NULL) {
-        return STL_String_memory_error;
+    /* One extra character is always kept for the terminating zero */
+    if (nchar < new_max) {
+        return STL_String_OK;
     }
-    memcpy(tmp, self->data, self->nchar * self->charWidth);
 
-    if (STL_String_allocate_size(self, new_size, YES) != STL_String_OK) {
-        return STL_String_memory_error;
+    while (nchar >= new_max) {
+        new_max *= 2;
     }
 
-    self->max_nchar = new_size / self->charWidth;
-    self->nchar = (self->nchar > self->max_nchar) ? self->max_nchar : self->nchar;
+    /* Returning value */
+    return STL_String_reallocate(self, new_max * self->charWidth);
+}
+
+static void STL_String_terminate(STL_String *self)
+{
 
-    memcpy(self->data, tmp, self->charWidth * self->nchar);
+    /* Main part */
+    memset(self->data + self->nchar * self->charWidth, 0, self->charWidth);
+}
 
-    free(tmp);
+static STL_String_view STL_String_as_view(STL_String *self)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+    view.data = NULL;
+    view.nchar = 0;
+
+    /* Main part */
+    STL_String_view_init_string(&view, self);
 
     /* Returning value */
-    return STL_String_OK;
+    return view;
+}
+
+int __STL_String_prepare_write(STL_String *self)
+{
+
+    /* Main part */
+    self->hash = 0;
+
+    /* Returning value */
+    return (self->refs != NULL && __atomic_load_n(self->refs, __ATOMIC_ACQUIRE) > 1)
+               ? STL_String_reallocate(self, self->max_nchar * self->charWidth)
+               : STL_String_OK;
 }
 
 int STL_String_init(STL_String *self)
 {
 
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
     /* Initializing variables */
     if (STL_String_allocate_size(self, thresh, NO) != STL_String_OK) {
         return STL_String_memory_error;
@@ -89,6 +175,7 @@ int STL_String_init(STL_String *self)
     self->nchar = 0;
     self->max_nchar = thresh;
     self->charWidth = 1;
+    self->hash = 0;
 
     /* Returning value */
     return STL_String_OK;
@@ -102,6 +189,17 @@ int STL_String_init_cpy(STL_String *self, STL_String *other)
         return STL_String_null_reference_error;
     }
 
+    if (other->refs != NULL) {
+        __atomic_add_fetch(other->refs, 1, __ATOMIC_RELAXED);
+        self->data = other->data;
+        self->refs = other->refs;
+        self->nchar = other->nchar;
+        self->max_nchar = other->max_nchar;
+        self->charWidth = other->charWidth;
+        self->hash = other->hash;
+        return STL_String_OK;
+    }
+
     if (STL_String_allocate_size(self, other->charWidth * other->max_nchar, NO) != STL_String_OK) {
         return STL_String_memory_error;
     }
@@ -110,6 +208,7 @@ int STL_String_init_cpy(STL_String *self, STL_String *other)
     self->nchar = other->nchar;
     self->max_nchar = other->max_nchar;
     self->charWidth = other->charWidth;
+    self->hash = other->hash;
 
     /* Returning value */
     return STL_String_OK;
@@ -124,7 +223,37 @@ void STL_String_delete(STL_String *self)
     }
 
     /* Main part */
+    STL_String_release(self);
+}
+
+int STL_String_share(STL_String *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto char *block;
+
+    /* Main part */
+    if (self->refs != NULL) {
+        return STL_String_OK;
+    }
+
+    if ((block = malloc(shared_header + self->max_nchar * self->charWidth)) == NULL) {
+        return STL_String_memory_error;
+    }
+
+    memcpy(block + shared_header, self->data, (self->nchar + 1) * self->charWidth);
     free(self->data);
+    self->data = block + shared_header;
+    self->refs = (size_t *) block;
+    *self->refs = 1;
+
+    /* Returning value */
+    return STL_String_OK;
 }
 
 char *STL_String_at(STL_String *self, size_t n)
@@ -139,6 +268,11 @@ char *STL_String_at(STL_String *self, size_t n)
         return NULL;
     }
 
+    /* Main part */
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        return NULL;
+    }
+
     /* Returning value */
     return (char *) (self->data + n);
 }
@@ -153,6 +287,11 @@ char *STL_String_front(STL_String *self)
 char *STL_String_back(STL_String *self)
 {
 
+    /* VarCheck */
+    if (self == NULL || !self->nchar) {
+        return NULL;
+    }
+
     /* Returning value */
     return STL_String_at(self, self->nchar - 1);
 }
@@ -165,6 +304,11 @@ char *STL_String_data(STL_String *self)
         return NULL;
     }
 
+    /* Main part */
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        return NULL;
+    }
+
     /* Returning value */
     return (char *) self->data;
 }
@@ -172,8 +316,13 @@ char *STL_String_data(STL_String *self)
 const char *STL_String_c_str(STL_String *self)
 {
 
+    /* VarCheck */
+    if (self == NULL) {
+        return NULL;
+    }
+
     /* Returning value */
-    return (const char *) STL_String_data(self);
+    return (const char *) self->data;
 }
 
 char *STL_String_begin(STL_String *self)
@@ -184,6 +333,11 @@ char *STL_String_begin(STL_String *self)
         return NULL;
     }
 
+    /* Main part */
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        return NULL;
+    }
+
     /* Returning value */
     return (char *) self->data;
 }
@@ -196,6 +350,11 @@ char *STL_String_end(STL_String *self)
         return NULL;
     }
 
+    /* Main part */
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        return NULL;
+    }
+
     /* Returning value */
     return (char *) (self->data + self->nchar * self->charWidth);
 }
@@ -240,12 +399,12 @@ int STL_String_reserve(STL_String *self, size_t new_cap)
     }
 
     /* Main part */
-    if (new_cap <= STL_String_capacity(self)) {
+    if (new_cap < STL_String_capacity(self)) {
         return STL_String_OK;
     }
 
     /* Returning value */
-    return STL_String_reallocate(self, new_cap * self->charWidth);
+    return STL_String_reallocate(self, (new_cap + 1) * self->charWidth);
 }
 
 size_t STL_String_capacity(STL_String *self)
@@ -269,7 +428,7 @@ int STL_String_shrink_to_fit(STL_String *self)
     }
 
     /* Returning value */
-    return STL_String_reallocate(self, self->charWidth * self->nchar);
+    return STL_String_reallocate(self, self->charWidth * (self->nchar + 1));
 }
 
 void STL_String_clear(STL_String *self)
@@ -281,7 +440,11 @@ void STL_String_clear(STL_String *self)
     }
 
     /* Main part */
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        return;
+    }
     self->nchar = 0;
+    STL_String_terminate(self);
 }
 
 int STL_String_insert(STL_String *self, size_t pos, char ch, size_t count)
@@ -292,28 +455,20 @@ int STL_String_insert(STL_String *self, size_t pos, char ch, size_t count)
         return STL_String_null_reference_error;
     }
 
-    if (pos > self->nchar + 1) {
+    if (pos > self->nchar) {
         return STL_String_index_error;
     }
 
-    /* Initializing variables */
-    register size_t i;
-    auto size_t newSize;
-
     /* Main part */
-    newSize = self->nchar + count;
-    while (newSize >= self->max_nchar - 1) {
-        if (STL_String_reallocate(self, self->max_nchar * 2) != STL_String_OK) {
-            return STL_String_memory_error;
-        }
-    }
-    self->nchar = newSize;
-    memmove(self->data + pos + count,
-            self->data + pos, count);
-    for (i = 0; i < count; ++i) {
-        *((char *) (self->data + pos + i)) = ch;
+    if (__STL_String_prepare_write(self) != STL_String_OK ||
+        __STL_String_grow(self, self->nchar + count) != STL_String_OK) {
+        return STL_String_memory_error;
     }
-    *((char *) (self->data + self->nchar)) = '\0';
+
+    memmove(self->data + pos + count, self->data + pos, self->nchar - pos);
+    memset(self->data + pos, ch, count);
+    self->nchar += count;
+    STL_String_terminate(self);
 
     /* Returning value */
     return STL_String_OK;
@@ -323,32 +478,50 @@ int STL_String_insert_str(STL_String *self, size_t pos, const char *str)
 {
 
     /* VarCheck */
-    if (self == NULL) {
+    if (str == NULL) {
         return STL_String_null_reference_error;
     }
 
-    if (pos > self->nchar + 1) {
-        return STL_String_index_error;
-    }
+    /* Returning value */
+    return STL_String_insert_str_n(self, pos, str, strlen(str));
+}
+
+int STL_String_insert_str_n(STL_String *self, size_t pos, const char *str, size_t count)
+{
 
     /* Initializing variables */
-    auto size_t len = strlen(str);
-    auto size_t newSize;
+    auto char *copy = NULL;
+
+    /* VarCheck */
+    if (self == NULL || (str == NULL && count)) {
+        return STL_String_null_reference_error;
+    }
+
+    if (pos > self->nchar) {
+        return STL_String_index_error;
+    }
 
     /* Main part */
-    newSize = self->nchar + len;
-    while (newSize >= self->max_nchar - 1) {
-        if (STL_String_reallocate(self, self->max_nchar * 2) != STL_String_OK) {
+    /* "str" may point into our own buffer, which is about to move */
+    if (str >= (const char *) self->data && str < (const char *) (self->data + self->max_nchar)) {
+        if ((copy = malloc(count)) == NULL) {
             return STL_String_memory_error;
         }
+        str = memcpy(copy, str, count);
     }
 
-    if (pos != self->nchar) {
-        memmove(self->data + pos + len,
-                self->data + pos, strlen(self->data + pos));
+    if (__STL_String_prepare_write(self) != STL_String_OK ||
+        __STL_String_grow(self, self->nchar + count) != STL_String_OK) {
+        free(copy);
+        return STL_String_memory_error;
     }
-    self->nchar = newSize;
-    memcpy(self->data + pos, str, len);
+
+    memmove(self->data + pos + count, self->data + pos, self->nchar - pos);
+    memcpy(self->data + pos, str, count);
+    self->nchar += count;
+    STL_String_terminate(self);
+
+    free(copy);
 
     /* Returning value */
     return STL_String_OK;
@@ -362,7 +535,7 @@ void STL_String_erase(STL_String *self, size_t pos, size_t count)
         return;
     }
 
-    if (STL_String_empty(self)) {
+    if (pos >= self->nchar) {
         return;
     }
 
@@ -370,68 +543,132 @@ void STL_String_erase(STL_String *self, size_t pos, size_t count)
     auto size_t toRemove = min(count, self->nchar - pos);
 
     /* Main part */
-    self->nchar -= count;
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        return;
+    }
 
-    memmove(self->data + pos, self->data + pos + toRemove, strlen(self->data + pos + toRemove) + 1);
+    memmove(self->data + pos, self->data + pos + toRemove, self->nchar - pos - toRemove);
+    self->nchar -= toRemove;
+    STL_String_terminate(self);
 }
 
 void STL_String_push_back(STL_String *self, char ch)
 {
 
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
+
     /* Main part */
-    STL_String_insert(self, self->nchar, ch, 1lu);
+    if (__STL_String_prepare_write(self) != STL_String_OK || __STL_String_grow(self, self->nchar + 1) != STL_String_OK) {
+        return;
+    }
+
+    *((char *) (self->data + self->nchar++)) = ch;
+    STL_String_terminate(self);
 }
 
 void STL_String_pop_back(STL_String *self)
 {
 
+    /* VarCheck */
+    if (self == NULL || !self->nchar) {
+        return;
+    }
+
     /* Main part */
-    STL_String_erase(self, self->nchar, 1lu);
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        return;
+    }
+
+    --self->nchar;
+    STL_String_terminate(self);
 }
 
 void STL_String_append(STL_String *self, char ch, size_t count)
 {
 
     /* Main part */
-    STL_String_insert(self, self->nchar, ch, count);
+    STL_String_insert(self, STL_String_size(self), ch, count);
 }
 
 void STL_String_append_str(STL_String *self, const char *str)
 {
 
     /* Main part */
-    STL_String_insert_str(self, self->nchar, str);
+    STL_String_insert_str(self, STL_String_size(self), str);
+}
+
+void STL_String_append_str_n(STL_String *self, const char *str, size_t count)
+{
+
+    /* Main part */
+    STL_String_insert_str_n(self, STL_String_size(self), str, count);
 }
 
 int STL_String_compare(STL_String *self, STL_String *other)
 {
 
+    /* Initializing variables */
+    auto STL_String_view a = STL_String_as_view(self), b = STL_String_as_view(other);
+
     /* Returning value */
-    return strcmp(self->data, other->data);
+    return STL_String_view_compare(&a, &b);
 }
 
 int STL_String_starts_with(STL_String *self, const char *prefix)
 {
 
     /* VarCheck */
-    if (self == NULL || prefix == NULL) {
+    if (prefix == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_starts_with_n(self, prefix, strlen(prefix));
+}
+
+int STL_String_starts_with_n(STL_String *self, const char *prefix, size_t count)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view = STL_String_as_view(self);
+
+    /* VarCheck */
+    if (self == NULL) {
         return STL_String_null_reference_error;
     }
 
     /* Returning value */
-    return strstr(self->data, prefix) == self->data;
+    return STL_String_view_starts_with_n(&view, prefix, count);
 }
 
 int STL_String_ends_with(STL_String *self, const char *prefix)
 {
 
     /* VarCheck */
-    if (self == NULL || prefix == NULL) {
+    if (prefix == NULL) {
         return STL_String_null_reference_error;
     }
 
     /* Returning value */
-    return strlen(strstr(self->data, prefix)) == strlen(self->data);
+    return STL_String_ends_with_n(self, prefix, strlen(prefix));
+}
+
+int STL_String_ends_with_n(STL_String *self, const char *suffix, size_t count)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view = STL_String_as_view(self);
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_ends_with_n(&view, suffix, count);
 }
 
 void STL_String_replace(STL_String *self, size_t pos, const char *str, size_t count)
@@ -442,14 +679,180 @@ void STL_String_replace(STL_String *self, size_t pos, const char *str, size_t co
         return;
     }
 
+    /* Main part */
+    STL_String_replace_n(self, pos, count, str, strlen(str));
+}
+
+int STL_String_replace_n(STL_String *self, size_t pos, size_t count, const char *str, size_t str_count)
+{
+
+    /* Initializing variables */
+    auto char *copy = NULL;
+    auto size_t toReplace;
+    auto int code = STL_String_OK;
+
+    /* VarCheck */
+    if (self == NULL || (str == NULL && str_count)) {
+        return STL_String_null_reference_error;
+    }
+
+    if (pos > self->nchar) {
+        return STL_String_index_error;
+    }
+
+    /* Main part */
+    if (str >= (const char *) self->data && str < (const char *) (self->data + self->max_nchar)) {
+        if ((copy = malloc(str_count)) == NULL) {
+            return STL_String_memory_error;
+        }
+        str = memcpy(copy, str, str_count);
+    }
+
+    /* Overwrite the common part, then grow or shrink the gap once */
+    toReplace = min(count, self->nchar - pos);
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        code = STL_String_memory_error;
+    } else if (str_count > toReplace) {
+        code = STL_String_insert_str_n(self, pos + toReplace, str + toReplace, str_count - toReplace);
+        if (code == STL_String_OK) {
+            memcpy(self->data + pos, str, toReplace);
+        }
+    } else {
+        memcpy(self->data + pos, str, str_count);
+        STL_String_erase(self, pos + str_count, toReplace - str_count);
+    }
+
+    free(copy);
+
+    /* Returning value */
+    return code;
+}
+
+static int STL_String_replace_matches(STL_String *self, const char *pattern, size_t pattern_count, const char *str,
+                                      size_t str_count, size_t limit)
+{
+
     /* Initializing variables */
-    register size_t i;
-    auto int toReplace = min(count, self->nchar - pos);
+    auto STL_String_view rest;
+    auto char *copy = NULL, *data, *result;
+    auto size_t read = 0, write = 0, found, nmatches, new_nchar, new_max;
+
+    /* VarCheck */
+    if (self == NULL || pattern == NULL || (str == NULL && str_count)) {
+        return STL_String_null_reference_error;
+    }
+
+    if (!pattern_count) {
+        return STL_String_index_error;
+    }
+
+    if (self->charWidth != sizeof(char)) {
+        return STL_String_encoding_error;
+    }
 
     /* Main part */
-    for (i = 0; i < toReplace; ++i) {
-        *((char *) self->nchar + pos + i) = *(str + i);
+    data = self->data;
+    if ((pattern >= data && pattern < data + self->max_nchar) || (str >= data && str < data + self->max_nchar)) {
+        if ((copy = malloc(pattern_count + str_count)) == NULL) {
+            return STL_String_memory_error;
+        }
+        pattern = memcpy(copy, pattern, pattern_count);
+        str = memcpy(copy + pattern_count, str, str_count);
+    }
+
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        free(copy);
+        return STL_String_memory_error;
+    }
+    data = self->data;
+
+    if (str_count <= pattern_count) {
+        /* The result never outgrows the source, so it's compacted in place behind the read position */
+        for (nmatches = 0; nmatches < limit; ++nmatches) {
+            STL_String_view_init(&rest, data + read, self->nchar - read);
+            if ((found = STL_String_view_find_n(&rest, pattern, pattern_count)) == npos) {
+                break;
+            }
+
+            memmove(data + write, data + read, found);
+            memcpy(data + write + found, str, str_count);
+            write += found + str_count;
+            read += found + pattern_count;
+        }
+
+        memmove(data + write, data + read, self->nchar - read);
+        self->nchar = write + self->nchar - read;
+        STL_String_terminate(self);
+
+        free(copy);
+        return STL_String_OK;
+    }
+
+    /* Count the matches first, so the result is allocated once and written front to back */
+    for (nmatches = 0; nmatches < limit; ++nmatches) {
+        STL_String_view_init(&rest, data + read, self->nchar - read);
+        if ((found = STL_String_view_find_n(&rest, pattern, pattern_count)) == npos) {
+            break;
+        }
+        read += found + pattern_count;
+    }
+
+    if (nmatches) {
+        new_nchar = self->nchar + nmatches * (str_count - pattern_count);
+        for (new_max = self->max_nchar; new_nchar >= new_max; new_max *= 2)
+            ;
+
+        if ((result = malloc(new_max)) == NULL) {
+            free(copy);
+            return STL_String_memory_error;
+        }
+
+        for (read = 0; nmatches; --nmatches) {
+            STL_String_view_init(&rest, data + read, self->nchar - read);
+            found = STL_String_view_find_n(&rest, pattern, pattern_count);
+
+            memcpy(result + write, data + read, found);
+            memcpy(result + write + found, str, str_count);
+            write += found + str_count;
+            read += found + pattern_count;
+        }
+        memcpy(result + write, data + read, self->nchar - read);
+
+        STL_String_release(self);
+        self->data = result;
+        self->nchar = new_nchar;
+        self->max_nchar = new_max;
+        STL_String_terminate(self);
+    }
+
+    free(copy);
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_replace_all(STL_String *self, const char *pattern, const char *str)
+{
+
+    /* VarCheck */
+    if (pattern == NULL || str == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_replace_matches(self, pattern, strlen(pattern), str, strlen(str), npos);
+}
+
+int STL_String_replace_first_n(STL_String *self, const char *pattern, const char *str, size_t n)
+{
+
+    /* VarCheck */
+    if (pattern == NULL || str == NULL) {
+        return STL_String_null_reference_error;
     }
+
+    /* Returning value */
+    return STL_String_replace_matches(self, pattern, strlen(pattern), str, strlen(str), n);
 }
 
 STL_String STL_String_substr(STL_String *self, size_t pos, size_t count)
@@ -461,43 +864,57 @@ STL_String STL_String_substr(STL_String *self, size_t pos, size_t count)
     str.max_nchar = 0;
     str.data = NULL;
     str.charWidth = 0;
+    str.hash = 0;
+    str.refs = NULL;
 
     /* VarCheck */
-    if (self == NULL) {
+    if (self == NULL || pos > self->nchar) {
         return str;
     }
 
     auto size_t toReturn = min(count, self->nchar - pos);
 
     /* Main part */
-    STL_String_init(self);
-    STL_String_insert_str(&str, 0, STL_String_data(self));
+    if (STL_String_init(&str) != STL_String_OK) {
+        return str;
+    }
+    if (STL_String_reserve(&str, toReturn) != STL_String_OK) {
+        STL_String_delete(&str);
+        str.data = NULL;
+        return str;
+    }
+
+    memcpy(str.data, self->data + pos, toReturn);
+    str.nchar = toReturn;
+    STL_String_terminate(&str);
 
     /* Returning value */
     return str;
 }
 
+STL_String_view STL_String_substr_view(STL_String *self, size_t pos, size_t count)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view = STL_String_as_view(self);
+
+    /* Returning value */
+    return STL_String_view_substr(&view, pos, count);
+}
+
 size_t STL_String_copy(STL_String *self, char *dest, size_t count, size_t pos)
 {
 
+    /* Initializing variables */
+    auto STL_String_view view = STL_String_as_view(self);
+
     /* VarCheck */
     if (self == NULL || dest == NULL) {
         return STL_String_null_reference_error;
     }
 
-    /* Initializing variables */
-    auto size_t toCopy = min(count, self->nchar - pos);
-
-    /* Main part */
-    while (self->nchar + pos >= self->max_nchar) {
-        if (STL_String_reallocate(self, self->max_nchar * 2) != STL_String_OK) {
-            return STL_String_memory_error;
-        }
-    }
-    memcpy(dest, (const void *) self->nchar + pos, toCopy);
-
     /* Returning value */
-    return toCopy;
+    return STL_String_view_copy(&view, dest, count, pos);
 }
 
 int STL_String_resize(STL_String *self, size_t count)
@@ -509,10 +926,16 @@ int STL_String_resize(STL_String *self, size_t count)
     }
 
     /* Main part */
-    if (STL_String_reallocate(self, count) != STL_String_OK) {
+    if (__STL_String_prepare_write(self) != STL_String_OK || __STL_String_grow(self, count) != STL_String_OK) {
         return STL_String_memory_error;
     }
 
+    if (count > self->nchar) {
+        memset(self->data + self->nchar * self->charWidth, 0, (count - self->nchar) * self->charWidth);
+    }
+    self->nchar = count;
+    STL_String_terminate(self);
+
     /* Returning value */
     return STL_String_OK;
 }
@@ -532,161 +955,106 @@ void STL_String_swap(STL_String *self, STL_String *other)
     tmp.nchar = other->nchar;
     tmp.charWidth = other->charWidth;
     tmp.max_nchar = other->max_nchar;
+    tmp.hash = other->hash;
+    tmp.refs = other->refs;
 
     other->data = self->data;
     other->nchar = self->nchar;
     other->charWidth = self->charWidth;
     other->max_nchar = self->max_nchar;
+    other->hash = self->hash;
+    other->refs = self->refs;
 
     self->data = tmp.data;
     self->nchar = tmp.nchar;
     self->charWidth = tmp.charWidth;
     self->max_nchar = tmp.max_nchar;
+    self->hash = tmp.hash;
+    self->refs = tmp.refs;
 }
 
 size_t STL_String_find(STL_String *self, const char *str)
 {
 
     /* VarCheck */
-    if (self == NULL || str == NULL) {
-        return STL_String_null_reference_error;
+    if (str == NULL) {
+        return npos;
     }
 
+    /* Returning value */
+    return STL_String_find_n(self, str, strlen(str));
+}
+
+size_t STL_String_find_n(STL_String *self, const char *str, size_t count)
+{
+
     /* Initializing variables */
-    auto char *substr = strstr(self->data, str);
+    auto STL_String_view view = STL_String_as_view(self);
 
     /* Returning value */
-    return (substr == NULL) ? npos : (substr - (char *) self->data);
+    return STL_String_view_find_n(&view, str, count);
 }
 
 size_t STL_String_rfind(STL_String *self, const char *str)
 {
 
     /* VarCheck */
-    if (self == NULL || str == NULL) {
-        return STL_String_null_reference_error;
+    if (str == NULL) {
+        return npos;
     }
 
-    /* Initializing variables */
-    auto char *substr, *temp;
+    /* Returning value */
+    return STL_String_rfind_n(self, str, strlen(str));
+}
 
-    /* Main part */
-    while ((temp = strstr(self->data, str)) != NULL) {
-        substr = temp;
-    }
+size_t STL_String_rfind_n(STL_String *self, const char *str, size_t count)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view = STL_String_as_view(self);
 
     /* Returning value */
-    return (substr == NULL) ? npos : (substr - (char *) self->data);
+    return STL_String_view_rfind_n(&view, str, count);
 }
 
 size_t STL_String_find_first_of(STL_String *self, const char *str)
 {
 
-    /* VarCheck */
-    if (self == NULL || str == NULL) {
-        return STL_String_null_reference_error;
-    }
-
     /* Initializing variables */
-    register char *iter;
-    register const char *iterStr;
-
-    /* Main part */
-    for (iter = STL_String_begin(self); iter != STL_String_end(self); ++iter) {
-        for (iterStr = str; *iterStr != '\0'; ++iterStr) {
-            if (*iter == *iterStr) {
-                return iter - (char *) self->data;
-            }
-        }
-    }
+    auto STL_String_view view = STL_String_as_view(self);
 
     /* Returning value */
-    return npos;
+    return STL_String_view_find_first_of(&view, str);
 }
 
 size_t STL_String_find_first_not_of(STL_String *self, const char *str)
 {
 
-    /* VarCheck */
-    if (self == NULL || str == NULL) {
-        return STL_String_null_reference_error;
-    }
-
     /* Initializing variables */
-    register char *iter;
-    register const char *iterStr;
-    auto size_t notMatched;
-
-    /* Main part */
-    for (iter = STL_String_begin(self); iter != STL_String_end(self); ++iter) {
-        for (iterStr = str, notMatched = 0; *iterStr != '\0'; ++iterStr) {
-            if (*iter != *iterStr) {
-                ++notMatched;
-            }
-        }
-
-        if (notMatched == strlen(str)) {
-            return iter - (char *) self->data;
-        }
-    }
+    auto STL_String_view view = STL_String_as_view(self);
 
     /* Returning value */
-    return npos;
+    return STL_String_view_find_first_not_of(&view, str);
 }
 
 size_t STL_String_find_last_of(STL_String *self, const char *str)
 {
 
-    /* VarCheck */
-    if (self == NULL || str == NULL) {
-        return STL_String_null_reference_error;
-    }
-
     /* Initializing variables */
-    register char *iter;
-    register const char *iterStr;
-
-    /* Main part */
-    for (iter = STL_String_end(self) - 1; iter != STL_String_begin(self) - 1; --iter) {
-        for (iterStr = str; *iterStr != '\0'; ++iterStr) {
-            if (*iter == *iterStr) {
-                return iter - (char *) self->data;
-            }
-        }
-    }
+    auto STL_String_view view = STL_String_as_view(self);
 
     /* Returning value */
-    return npos;
+    return STL_String_view_find_last_of(&view, str);
 }
 
 size_t STL_String_find_last_not_of(STL_String *self, const char *str)
 {
 
-    /* VarCheck */
-    if (self == NULL || str == NULL) {
-        return STL_String_null_reference_error;
-    }
-
     /* Initializing variables */
-    register char *iter;
-    register const char *iterStr;
-    auto size_t notMatched;
-
-    /* Main part */
-    for (iter = STL_String_end(self) - 1; iter != STL_String_begin(self) - 1; --iter) {
-        for (iterStr = str, notMatched = 0; *iterStr != '\0'; ++iterStr) {
-            if (*iter != *iterStr) {
-                ++notMatched;
-            }
-        }
-
-        if (notMatched == strlen(str)) {
-            return iter - (char *) self->data;
-        }
-    }
+    auto STL_String_view view = STL_String_as_view(self);
 
     /* Returning value */
-    return npos;
+    return STL_String_view_find_last_not_of(&view, str);
 }
 
 size_t STL_String_npos()
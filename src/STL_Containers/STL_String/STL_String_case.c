@@ -0,0 +1,396 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String.h"
+#include "../../STL_Headers/STL/STL_String_view.h"
+#include "STL_String_internal.h"
+
+#include <string.h>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static const size_t npos = -1;
+
+static unsigned char STL_String_case_fold(unsigned char ch)
+{
+
+    /* Returning value */
+    return (unsigned char) ((unsigned) (ch - 'A') < 26u ? ch | 0x20 : ch);
+}
+
+/* Letters are found with one signed compare: ch - first + 0x80 falls below -0x80 + 26 only for the 26 letters */
+#if defined(__AVX2__)
+static __m256i STL_String_case_fold_256(__m256i chunk)
+{
+
+    /* Initializing variables */
+    auto __m256i shifted = _mm256_add_epi8(chunk, _mm256_set1_epi8((char) (0x80 - 'A')));
+
+    /* Returning value */
+    return _mm256_or_si256(chunk, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(-0x80 + 26), shifted),
+                                                   _mm256_set1_epi8(0x20)));
+}
+#endif
+
+#if defined(__SSE2__)
+static __m128i STL_String_case_fold_128(__m128i chunk)
+{
+
+    /* Initializing variables */
+    auto __m128i shifted = _mm_add_epi8(chunk, _mm_set1_epi8((char) (0x80 - 'A')));
+
+    /* Returning value */
+    return _mm_or_si128(chunk, _mm_and_si128(_mm_cmplt_epi8(shifted, _mm_set1_epi8(-0x80 + 26)), _mm_set1_epi8(0x20)));
+}
+#endif
+
+static void STL_String_case_convert(unsigned char *data, size_t n, unsigned char first)
+{
+
+    /* Flips the case bit of the letters first..first + 25 */
+
+    /* Initializing variables */
+    register unsigned char *iter = data, *end = data + n;
+#if defined(__AVX2__)
+    auto __m256i chunk, shifted;
+#endif
+#if defined(__SSE2__)
+    auto __m128i chunk16, shifted16;
+#endif
+
+    /* Main part */
+#if defined(__AVX2__)
+    for (; end - iter >= 32; iter += 32) {
+        chunk = _mm256_loadu_si256((const __m256i *) iter);
+        shifted = _mm256_add_epi8(chunk, _mm256_set1_epi8((char) (0x80 - first)));
+        chunk = _mm256_xor_si256(chunk, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(-0x80 + 26), shifted),
+                                                         _mm256_set1_epi8(0x20)));
+        _mm256_storeu_si256((__m256i *) iter, chunk);
+    }
+#endif
+#if defined(__SSE2__)
+    for (; end - iter >= 16; iter += 16) {
+        chunk16 = _mm_loadu_si128((const __m128i *) iter);
+        shifted16 = _mm_add_epi8(chunk16, _mm_set1_epi8((char) (0x80 - first)));
+        chunk16 = _mm_xor_si128(chunk16, _mm_and_si128(_mm_cmplt_epi8(shifted16, _mm_set1_epi8(-0x80 + 26)),
+                                                       _mm_set1_epi8(0x20)));
+        _mm_storeu_si128((__m128i *) iter, chunk16);
+    }
+#endif
+
+    for (; iter != end; ++iter) {
+        if ((unsigned) (*iter - first) < 26u) {
+            *iter ^= 0x20;
+        }
+    }
+}
+
+static size_t STL_String_case_mismatch(const unsigned char *a, const unsigned char *b, size_t n)
+{
+
+    /* Returns the first position where the case-folded characters differ, or n */
+
+    /* Initializing variables */
+    register size_t i = 0;
+#if defined(__SSE2__)
+    auto unsigned mask;
+#endif
+
+    /* Main part */
+#if defined(__AVX2__)
+    for (; n - i >= 32; i += 32) {
+        mask = ~(unsigned) _mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(STL_String_case_fold_256(_mm256_loadu_si256((const __m256i *) (a + i))),
+                                  STL_String_case_fold_256(_mm256_loadu_si256((const __m256i *) (b + i)))));
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+#if defined(__SSE2__)
+    for (; n - i >= 16; i += 16) {
+        mask = ~(unsigned) _mm_movemask_epi8(
+                _mm_cmpeq_epi8(STL_String_case_fold_128(_mm_loadu_si128((const __m128i *) (a + i))),
+                               STL_String_case_fold_128(_mm_loadu_si128((const __m128i *) (b + i))))) & 0xFFFF;
+        if (mask) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    for (; i != n; ++i) {
+        if (STL_String_case_fold(a[i]) != STL_String_case_fold(b[i])) {
+            return i;
+        }
+    }
+
+    /* Returning value */
+    return n;
+}
+
+int STL_String_view_icompare(const STL_String_view *self, const STL_String_view *other)
+{
+
+    /* Initializing variables */
+    auto size_t n = (self->nchar < other->nchar) ? self->nchar : other->nchar;
+    auto size_t i = STL_String_case_mismatch((const unsigned char *) self->data, (const unsigned char *) other->data, n);
+
+    /* Main part */
+    if (i != n) {
+        return (STL_String_case_fold((unsigned char) self->data[i]) <
+                STL_String_case_fold((unsigned char) other->data[i])) ? -1 : 1;
+    }
+
+    /* Returning value */
+    return (self->nchar > other->nchar) ? 1 : (self->nchar < other->nchar) ? -1 : 0;
+}
+
+int STL_String_view_iequal(const STL_String_view *self, const STL_String_view *other)
+{
+
+    /* VarCheck */
+    if (self == NULL || other == NULL) {
+        return self == other;
+    }
+
+    /* Returning value */
+    return self->nchar == other->nchar &&
+           STL_String_case_mismatch((const unsigned char *) self->data, (const unsigned char *) other->data,
+                                    self->nchar) == self->nchar;
+}
+
+int STL_String_view_istarts_with(const STL_String_view *self, const char *prefix)
+{
+
+    /* VarCheck */
+    if (prefix == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_istarts_with_n(self, prefix, strlen(prefix));
+}
+
+int STL_String_view_istarts_with_n(const STL_String_view *self, const char *prefix, size_t count)
+{
+
+    /* VarCheck */
+    if (self == NULL || (prefix == NULL && count)) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return count <= self->nchar &&
+           STL_String_case_mismatch((const unsigned char *) self->data, (const unsigned char *) prefix, count) == count;
+}
+
+size_t STL_String_view_ifind(const STL_String_view *self, const char *str)
+{
+
+    /* VarCheck */
+    if (str == NULL) {
+        return npos;
+    }
+
+    /* Returning value */
+    return STL_String_view_ifind_n(self, str, strlen(str));
+}
+
+size_t STL_String_view_ifind_n(const STL_String_view *self, const char *str, size_t count)
+{
+
+    /* Initializing variables */
+    register const unsigned char *data, *needle = (const unsigned char *) str;
+    register size_t i = 0, last;
+    auto unsigned char first, tail;
+#if defined(__SSE2__)
+    auto __m128i first16, tail16;
+    auto unsigned mask;
+#endif
+
+    /* VarCheck */
+    if (self == NULL || (str == NULL && count)) {
+        return npos;
+    }
+
+    /* Main part */
+    if (count == 0) {
+        return 0;
+    } else if (count > self->nchar) {
+        return npos;
+    }
+
+    data = (const unsigned char *) self->data;
+    last = self->nchar - count;
+    first = STL_String_case_fold(needle[0]);
+    tail = STL_String_case_fold(needle[count - 1]);
+
+#if defined(__SSE2__)
+    /* Candidates must match the first and the last needle characters; only those are compared in full */
+    first16 = _mm_set1_epi8((char) first);
+    tail16 = _mm_set1_epi8((char) tail);
+    for (; i + 15 <= last; i += 16) {
+        mask = (unsigned) _mm_movemask_epi8(_mm_and_si128(
+                _mm_cmpeq_epi8(first16, STL_String_case_fold_128(_mm_loadu_si128((const __m128i *) (data + i)))),
+                _mm_cmpeq_epi8(tail16, STL_String_case_fold_128(
+                        _mm_loadu_si128((const __m128i *) (data + i + count - 1))))));
+        for (; mask; mask &= mask - 1) {
+            if (STL_String_case_mismatch(data + i + __builtin_ctz(mask) + 1, needle + 1, count - 1) == count - 1) {
+                return i + __builtin_ctz(mask);
+            }
+        }
+    }
+#endif
+
+    for (; i <= last; ++i) {
+        if (STL_String_case_fold(data[i]) == first &&
+            STL_String_case_mismatch(data + i + 1, needle + 1, count - 1) == count - 1) {
+            return i;
+        }
+    }
+
+    /* Returning value */
+    return npos;
+}
+
+void STL_String_to_lower(STL_String *self)
+{
+
+    /* VarCheck */
+    if (self == NULL || self->charWidth != sizeof(char)) {
+        return;
+    }
+
+    /* Main part */
+    if (__STL_String_prepare_write(self) == STL_String_OK) {
+        STL_String_case_convert(self->data, self->nchar, 'A');
+    }
+}
+
+void STL_String_to_upper(STL_String *self)
+{
+
+    /* VarCheck */
+    if (self == NULL || self->charWidth != sizeof(char)) {
+        return;
+    }
+
+    /* Main part */
+    if (__STL_String_prepare_write(self) == STL_String_OK) {
+        STL_String_case_convert(self->data, self->nchar, 'a');
+    }
+}
+
+int STL_String_icompare(STL_String *self, STL_String *other)
+{
+
+    /* Initializing variables */
+    auto STL_String_view a, b;
+
+    /* Main part */
+    STL_String_view_init_string(&a, self);
+    STL_String_view_init_string(&b, other);
+
+    /* Returning value */
+    return STL_String_view_icompare(&a, &b);
+}
+
+int STL_String_iequal(STL_String *self, STL_String *other)
+{
+
+    /* Initializing variables */
+    auto STL_String_view a, b;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL) {
+        return self == other;
+    }
+
+    /* Main part */
+    STL_String_view_init_string(&a, self);
+    STL_String_view_init_string(&b, other);
+
+    /* Returning value */
+    return self->charWidth == other->charWidth && STL_String_view_iequal(&a, &b);
+}
+
+int STL_String_istarts_with(STL_String *self, const char *prefix)
+{
+
+    /* VarCheck */
+    if (prefix == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_istarts_with_n(self, prefix, strlen(prefix));
+}
+
+int STL_String_istarts_with_n(STL_String *self, const char *prefix, size_t count)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    STL_String_view_init_string(&view, self);
+
+    /* Returning value */
+    return STL_String_view_istarts_with_n(&view, prefix, count);
+}
+
+size_t STL_String_ifind(STL_String *self, const char *str)
+{
+
+    /* VarCheck */
+    if (str == NULL) {
+        return npos;
+    }
+
+    /* Returning value */
+    return STL_String_ifind_n(self, str, strlen(str));
+}
+
+size_t STL_String_ifind_n(STL_String *self, const char *str, size_t count)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return npos;
+    }
+
+    /* Main part */
+    STL_String_view_init_string(&view, self);
+
+    /* Returning value */
+    return STL_String_view_ifind_n(&view, str, count);
+}
@@ -0,0 +1,805 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String.h"
+#include "STL_String_internal.h"
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+
+#ifndef va_copy
+#define va_copy(dest, src) __va_copy(dest, src)
+#endif
+
+static const char digit_pairs[] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static const double pow10_table[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const unsigned long long pow10_int[] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+    1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+    100000000000000ull, 1000000000000000ull, 10000000000000000ull
+};
+
+/* Longest precision the exact-scaling float paths accept */
+static const int max_fast_precision = 15;
+
+enum format_kind {
+    FORMAT_SIGNED,
+    FORMAT_UNSIGNED,
+    FORMAT_DOUBLE,
+    FORMAT_LONG_DOUBLE,
+    FORMAT_CHAR,
+    FORMAT_WIDE_CHAR,
+    FORMAT_STRING,
+    FORMAT_WIDE_STRING,
+    FORMAT_POINTER
+};
+
+/* Parsed conversion specification */
+struct format_spec {
+    char flags[8];
+    size_t nflags;
+    int width;
+    int precision;
+    char length[3];
+    char conv;
+};
+
+union format_value {
+    long long s;
+    unsigned long long u;
+    double d;
+    long double ld;
+    int c;
+    wint_t wc;
+    const char *str;
+    const wchar_t *wstr;
+    const void *p;
+};
+
+static int STL_String_format_raw(STL_String *self, const char *str, size_t count)
+{
+
+    /* Main part */
+    if (__STL_String_grow(self, self->nchar + count) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    memcpy(self->data + self->nchar, str, count);
+    self->nchar += count;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+char *__STL_String_write_decimal(char *end, unsigned long long value)
+{
+
+    /* Writes "value" backwards, two digits per division. Returns the first character */
+
+    /* Initializing variables */
+    auto unsigned idx;
+
+    /* Main part */
+    while (value >= 100) {
+        idx = (unsigned) (value % 100) * 2;
+        value /= 100;
+        *--end = digit_pairs[idx + 1];
+        *--end = digit_pairs[idx];
+    }
+
+    if (value >= 10) {
+        *--end = digit_pairs[value * 2 + 1];
+        *--end = digit_pairs[value * 2];
+    } else {
+        *--end = (char) ('0' + value);
+    }
+
+    /* Returning value */
+    return end;
+}
+
+static char *STL_String_format_hex(char *end, unsigned long long value, int upper)
+{
+
+    /* Initializing variables */
+    auto const char *digits = upper ? "0123456789ABCDEF" : "0123456789abcdef";
+
+    /* Main part */
+    do {
+        *--end = digits[value & 15];
+        value >>= 4;
+    } while (value);
+
+    /* Returning value */
+    return end;
+}
+
+static char *STL_String_format_padded(char *p, unsigned long long value, int ndigits)
+{
+
+    /* Writes exactly "ndigits" digits of "value". Returns the end */
+
+    /* Initializing variables */
+    auto char *end = p + ndigits, *start = __STL_String_write_decimal(end, value);
+
+    /* Main part */
+    while (start > p) {
+        *--start = '0';
+    }
+
+    /* Returning value */
+    return end;
+}
+
+static int STL_String_format_round(double ax, int shift, unsigned long long *out)
+{
+
+    /* Rounds ax * 10^shift to the nearest integer. Returns 0 if the rounding can't be decided exactly */
+
+    /* Initializing variables */
+    auto double prod, frac, eps;
+    auto unsigned long long floor_prod;
+
+    /* Main part */
+    if (shift > 22 || shift < -22) {
+        return 0;
+    }
+
+    /* Powers of ten up to 1e22 are exact, so the product is off by at most half an ulp */
+    prod = (shift >= 0) ? ax * pow10_table[shift] : ax / pow10_table[-shift];
+    if (!(prod < 9007199254740992.0)) {
+        return 0;
+    }
+
+    floor_prod = (unsigned long long) prod;
+    frac = prod - (double) floor_prod;
+    eps = prod * 2.220446049250313e-16;
+
+    /* Only a product within an ulp of a half could round the other way */
+    if ((frac > 0.5 ? frac - 0.5 : 0.5 - frac) <= eps) {
+        return 0;
+    }
+
+    *out = floor_prod + (frac > 0.5);
+
+    /* Returning value */
+    return 1;
+}
+
+static int STL_String_format_digits(double ax, int ndigits, unsigned long long *digits, int *exp10)
+{
+
+    /* Rounds ax to "ndigits" significant digits: ax ~ digits * 10^(exp10 - ndigits + 1) */
+
+    /* Initializing variables */
+    auto uint64_t bits;
+    auto int x, i;
+
+    /* Main part */
+    if (ax == 0.0) {
+        *digits = 0;
+        *exp10 = 0;
+        return 1;
+    }
+
+    memcpy(&bits, &ax, sizeof(bits));
+    if ((bits >> 52) == 0) {
+        return 0;
+    }
+
+    /* floor(log10(2^e)) is a first guess, off by at most one */
+    x = ((int) (bits >> 52) - 1023) * 78913;
+    x = (x >= 0) ? x >> 18 : -((-x + (1 << 18) - 1) >> 18);
+
+    for (i = 0; i < 4; ++i) {
+        if (!STL_String_format_round(ax, ndigits - 1 - x, digits)) {
+            return 0;
+        }
+
+        if (*digits >= pow10_int[ndigits]) {
+            ++x;
+        } else if (*digits < pow10_int[ndigits - 1]) {
+            --x;
+        } else {
+            *exp10 = x;
+            return 1;
+        }
+    }
+
+    /* Returning value */
+    return 0;
+}
+
+static char *STL_String_format_exponent(char *p, int exp10, char e)
+{
+
+    /* Initializing variables */
+    auto char buf[8], *start;
+
+    /* Main part */
+    *p++ = e;
+    *p++ = (exp10 < 0) ? '-' : '+';
+    exp10 = (exp10 < 0) ? -exp10 : exp10;
+
+    if (exp10 < 10) {
+        *p++ = '0';
+    }
+    start = __STL_String_write_decimal(buf + sizeof(buf), (unsigned long long) exp10);
+    memcpy(p, start, buf + sizeof(buf) - start);
+
+    /* Returning value */
+    return p + (buf + sizeof(buf) - start);
+}
+
+static size_t STL_String_format_float(char *buf, double value, char conv, int precision)
+{
+
+    /* Formats %f, %e and %g without flags or width. Returns 0 if the libc path must be used */
+
+    /* Initializing variables */
+    auto char *p = buf, digits[24], *frac, *last;
+    auto unsigned long long d;
+    auto uint64_t bits;
+    auto int exp10, ndigits, decimals, i;
+    auto double ax;
+
+    /* Main part */
+    memcpy(&bits, &value, sizeof(bits));
+    ax = (bits >> 63) ? -value : value;
+    if (bits >> 63) {
+        *p++ = '-';
+    }
+
+    if (conv == 'f' || conv == 'F') {
+        precision = (precision < 0) ? 6 : precision;
+        if (precision > max_fast_precision || !STL_String_format_round(ax, precision, &d)) {
+            return 0;
+        }
+
+        frac = __STL_String_write_decimal(digits + sizeof(digits), d / pow10_int[precision]);
+        memcpy(p, frac, digits + sizeof(digits) - frac);
+        p += digits + sizeof(digits) - frac;
+        if (precision > 0) {
+            *p++ = '.';
+            p = STL_String_format_padded(p, d % pow10_int[precision], precision);
+        }
+
+        return p - buf;
+    }
+
+    if (conv == 'e' || conv == 'E') {
+        ndigits = ((precision < 0) ? 6 : precision) + 1;
+    } else {
+        ndigits = (precision < 0) ? 6 : (precision == 0) ? 1 : precision;
+    }
+
+    if (ndigits > max_fast_precision + 1 || !STL_String_format_digits(ax, ndigits, &d, &exp10)) {
+        return 0;
+    }
+    STL_String_format_padded(digits, d, ndigits);
+
+    if (conv == 'e' || conv == 'E') {
+        *p++ = digits[0];
+        if (ndigits > 1) {
+            *p++ = '.';
+            memcpy(p, digits + 1, ndigits - 1);
+            p += ndigits - 1;
+        }
+
+        return STL_String_format_exponent(p, exp10, conv) - buf;
+    }
+
+    /* %g: fixed notation for moderate exponents, trailing zeros dropped */
+    if (exp10 < ndigits && exp10 >= -4) {
+        if (exp10 >= 0) {
+            memcpy(p, digits, exp10 + 1);
+            p += exp10 + 1;
+            frac = digits + exp10 + 1;
+            decimals = ndigits - 1 - exp10;
+        } else {
+            *p++ = '0';
+            frac = digits;
+            decimals = ndigits;
+        }
+
+        for (last = frac + decimals; last > frac && *(last - 1) == '0'; --last)
+            ;
+        if (last > frac) {
+            *p++ = '.';
+            for (i = exp10; i < -1; ++i) {
+                *p++ = '0';
+            }
+            memcpy(p, frac, last - frac);
+            p += last - frac;
+        }
+
+        return p - buf;
+    }
+
+    *p++ = digits[0];
+    for (last = digits + ndigits; last > digits + 1 && *(last - 1) == '0'; --last)
+        ;
+    if (last > digits + 1) {
+        *p++ = '.';
+        memcpy(p, digits + 1, last - digits - 1);
+        p += last - digits - 1;
+    }
+
+    /* Returning value */
+    return STL_String_format_exponent(p, exp10, (conv == 'G') ? 'E' : 'e') - buf;
+}
+
+static const char *STL_String_format_parse(const char *p, struct format_spec *spec, va_list *args)
+{
+
+    /* Parses the specification following '%'. Returns the character after it or NULL if it's malformed */
+
+    /* Main part */
+    spec->nflags = 0;
+    spec->width = spec->precision = -1;
+    memset(spec->length, 0, sizeof(spec->length));
+
+    while (*p != '\0' && strchr("-+ #0'I", *p) != NULL) {
+        if (spec->nflags < sizeof(spec->flags) - 1) {
+            spec->flags[spec->nflags++] = *p;
+        }
+        ++p;
+    }
+
+    if (*p == '*') {
+        spec->width = va_arg(*args, int);
+        if (spec->width < 0) {
+            spec->width = -spec->width;
+            if (spec->nflags < sizeof(spec->flags) - 1) {
+                spec->flags[spec->nflags++] = '-';
+            }
+        }
+        ++p;
+    } else if (*p >= '0' && *p <= '9') {
+        for (spec->width = 0; *p >= '0' && *p <= '9'; ++p) {
+            spec->width = spec->width * 10 + (*p - '0');
+        }
+    }
+
+    if (*p == '.') {
+        ++p;
+        if (*p == '*') {
+            spec->precision = va_arg(*args, int);
+            spec->precision = (spec->precision < 0) ? -1 : spec->precision;
+            ++p;
+        } else {
+            for (spec->precision = 0; *p >= '0' && *p <= '9'; ++p) {
+                spec->precision = spec->precision * 10 + (*p - '0');
+            }
+        }
+    }
+
+    switch (*p) {
+        case 'h':
+        case 'l':
+            spec->length[0] = *p++;
+            if (*p == spec->length[0]) {
+                spec->length[1] = *p++;
+            }
+            break;
+        case 'q':
+            spec->length[0] = spec->length[1] = 'l';
+            ++p;
+            break;
+        case 'Z':
+            spec->length[0] = 'z';
+            ++p;
+            break;
+        case 'L':
+        case 'j':
+        case 'z':
+        case 't':
+            spec->length[0] = *p++;
+            break;
+        default:
+            break;
+    }
+
+    if (*p == '\0' || strchr("diouxXeEfFgGaAcspn%", *p) == NULL) {
+        return NULL;
+    }
+    spec->conv = *p;
+
+    /* Returning value */
+    return p + 1;
+}
+
+static long long STL_String_format_signed(const struct format_spec *spec, va_list *args)
+{
+
+    /* Main part */
+    switch (spec->length[0]) {
+        case 'h':
+            return (spec->length[1]) ? (signed char) va_arg(*args, int) : (short) va_arg(*args, int);
+        case 'l':
+            return (spec->length[1]) ? va_arg(*args, long long) : va_arg(*args, long);
+        case 'j':
+            return va_arg(*args, intmax_t);
+        case 'z':
+            return (ptrdiff_t) va_arg(*args, size_t);
+        case 't':
+            return va_arg(*args, ptrdiff_t);
+        default:
+            break;
+    }
+
+    /* Returning value */
+    return va_arg(*args, int);
+}
+
+static unsigned long long STL_String_format_unsigned(const struct format_spec *spec, va_list *args)
+{
+
+    /* Main part */
+    switch (spec->length[0]) {
+        case 'h':
+            return (spec->length[1]) ? (unsigned char) va_arg(*args, int) : (unsigned short) va_arg(*args, int);
+        case 'l':
+            return (spec->length[1]) ? va_arg(*args, unsigned long long) : va_arg(*args, unsigned long);
+        case 'j':
+            return va_arg(*args, uintmax_t);
+        case 'z':
+            return va_arg(*args, size_t);
+        case 't':
+            return (size_t) va_arg(*args, ptrdiff_t);
+        default:
+            break;
+    }
+
+    /* Returning value */
+    return va_arg(*args, unsigned int);
+}
+
+static int STL_String_format_snprintf(char *dest, size_t room, const char *fmt, enum format_kind kind,
+                                      const union format_value *value)
+{
+
+    /* Main part */
+    switch (kind) {
+        case FORMAT_SIGNED:
+            return snprintf(dest, room, fmt, value->s);
+        case FORMAT_UNSIGNED:
+            return snprintf(dest, room, fmt, value->u);
+        case FORMAT_DOUBLE:
+            return snprintf(dest, room, fmt, value->d);
+        case FORMAT_LONG_DOUBLE:
+            return snprintf(dest, room, fmt, value->ld);
+        case FORMAT_CHAR:
+            return snprintf(dest, room, fmt, value->c);
+        case FORMAT_WIDE_CHAR:
+            return snprintf(dest, room, fmt, value->wc);
+        case FORMAT_STRING:
+            return snprintf(dest, room, fmt, value->str);
+        case FORMAT_WIDE_STRING:
+            return snprintf(dest, room, fmt, value->wstr);
+        case FORMAT_POINTER:
+            return snprintf(dest, room, fmt, value->p);
+        default:
+            break;
+    }
+
+    /* Returning value */
+    return -1;
+}
+
+static int STL_String_format_libc(STL_String *self, const struct format_spec *spec, enum format_kind kind,
+                                  const union format_value *value)
+{
+
+    /* Rebuilds a single conversion with '*' resolved and lets snprintf() write it into the spare capacity */
+
+    /* Initializing variables */
+    auto char fmt[64], *p = fmt;
+    auto size_t room;
+    auto int n, i;
+
+    /* Main part */
+    *p++ = '%';
+    memcpy(p, spec->flags, spec->nflags);
+    p += spec->nflags;
+    if (spec->width >= 0) {
+        p += sprintf(p, "%d", spec->width);
+    }
+    if (spec->precision >= 0) {
+        p += sprintf(p, ".%d", spec->precision);
+    }
+
+    /* Integers were already widened to "long long" */
+    if (kind == FORMAT_SIGNED || kind == FORMAT_UNSIGNED) {
+        *p++ = 'l';
+        *p++ = 'l';
+    } else if (kind == FORMAT_LONG_DOUBLE) {
+        *p++ = 'L';
+    } else if (kind == FORMAT_WIDE_CHAR || kind == FORMAT_WIDE_STRING) {
+        *p++ = 'l';
+    }
+    *p++ = spec->conv;
+    *p = '\0';
+
+    for (i = 0; i < 2; ++i) {
+        room = self->max_nchar - self->nchar;
+        n = STL_String_format_snprintf(self->data + self->nchar, room, fmt, kind, value);
+        if (n < 0) {
+            return STL_String_encoding_error;
+        }
+
+        if ((size_t) n < room) {
+            self->nchar += n;
+            return STL_String_OK;
+        }
+
+        if (__STL_String_grow(self, self->nchar + n) != STL_String_OK) {
+            return STL_String_memory_error;
+        }
+    }
+
+    /* Returning value */
+    return STL_String_encoding_error;
+}
+
+static int STL_String_format_convert(STL_String *self, const struct format_spec *spec, va_list *args,
+                                     size_t start)
+{
+
+    /* Initializing variables */
+    auto int plain = (spec->nflags == 0 && spec->width < 0);
+    auto char buf[64], *end = buf + sizeof(buf), *p;
+    auto union format_value value;
+    auto size_t len;
+
+    /* Main part */
+    switch (spec->conv) {
+        case '%':
+            return STL_String_format_raw(self, "%", 1);
+        case 'd':
+        case 'i':
+            value.s = STL_String_format_signed(spec, args);
+            if (!plain || spec->precision >= 0) {
+                return STL_String_format_libc(self, spec, FORMAT_SIGNED, &value);
+            }
+            p = __STL_String_write_decimal(end, (value.s < 0) ? 0ull - (unsigned long long) value.s
+                                                             : (unsigned long long) value.s);
+            if (value.s < 0) {
+                *--p = '-';
+            }
+            return STL_String_format_raw(self, p, end - p);
+        case 'u':
+        case 'x':
+        case 'X':
+        case 'o':
+            value.u = STL_String_format_unsigned(spec, args);
+            if (!plain || spec->precision >= 0 || spec->conv == 'o') {
+                return STL_String_format_libc(self, spec, FORMAT_UNSIGNED, &value);
+            }
+            p = (spec->conv == 'u') ? __STL_String_write_decimal(end, value.u)
+                                    : STL_String_format_hex(end, value.u, spec->conv == 'X');
+            return STL_String_format_raw(self, p, end - p);
+        case 'e':
+        case 'E':
+        case 'f':
+        case 'F':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            if (spec->length[0] == 'L') {
+                value.ld = va_arg(*args, long double);
+                return STL_String_format_libc(self, spec, FORMAT_LONG_DOUBLE, &value);
+            }
+            value.d = va_arg(*args, double);
+            if (!plain || spec->conv == 'a' || spec->conv == 'A' ||
+                (len = STL_String_format_float(buf, value.d, spec->conv, spec->precision)) == 0) {
+                return STL_String_format_libc(self, spec, FORMAT_DOUBLE, &value);
+            }
+            return STL_String_format_raw(self, buf, len);
+        case 'c':
+            if (spec->length[0] == 'l') {
+                value.wc = va_arg(*args, wint_t);
+                return STL_String_format_libc(self, spec, FORMAT_WIDE_CHAR, &value);
+            }
+            value.c = va_arg(*args, int);
+            if (!plain) {
+                return STL_String_format_libc(self, spec, FORMAT_CHAR, &value);
+            }
+            buf[0] = (char) value.c;
+            return STL_String_format_raw(self, buf, 1);
+        case 's':
+            if (spec->length[0] == 'l') {
+                value.wstr = va_arg(*args, const wchar_t *);
+                return STL_String_format_libc(self, spec, FORMAT_WIDE_STRING, &value);
+            }
+            value.str = va_arg(*args, const char *);
+            if (!plain || value.str == NULL) {
+                return STL_String_format_libc(self, spec, FORMAT_STRING, &value);
+            }
+            if (spec->precision < 0) {
+                return STL_String_format_raw(self, value.str, strlen(value.str));
+            }
+            p = memchr(value.str, '\0', spec->precision);
+            return STL_String_format_raw(self, value.str,
+                                         (p != NULL) ? (size_t) (p - value.str) : (size_t) spec->precision);
+        case 'p':
+            value.p = va_arg(*args, const void *);
+            return STL_String_format_libc(self, spec, FORMAT_POINTER, &value);
+        case 'n':
+            len = self->nchar - start;
+            switch (spec->length[0]) {
+                case 'h':
+                    if (spec->length[1]) {
+                        *va_arg(*args, signed char *) = (signed char) len;
+                    } else {
+                        *va_arg(*args, short *) = (short) len;
+                    }
+                    break;
+                case 'l':
+                    if (spec->length[1]) {
+                        *va_arg(*args, long long *) = (long long) len;
+                    } else {
+                        *va_arg(*args, long *) = (long) len;
+                    }
+                    break;
+                case 'j':
+                    *va_arg(*args, intmax_t *) = (intmax_t) len;
+                    break;
+                case 'z':
+                    *va_arg(*args, size_t *) = len;
+                    break;
+                case 't':
+                    *va_arg(*args, ptrdiff_t *) = (ptrdiff_t) len;
+                    break;
+                default:
+                    *va_arg(*args, int *) = (int) len;
+                    break;
+            }
+            return STL_String_OK;
+        default:
+            break;
+    }
+
+    /* Returning value */
+    return STL_String_encoding_error;
+}
+
+static int STL_String_format_positional(STL_String *self, const char *format, va_list args)
+{
+
+    /* "%1$d" arguments can't be consumed in order, so the whole format goes through vsnprintf() */
+
+    /* Initializing variables */
+    auto va_list copy;
+    auto size_t room;
+    auto int n, i;
+
+    /* Main part */
+    for (i = 0; i < 2; ++i) {
+        room = self->max_nchar - self->nchar;
+        va_copy(copy, args);
+        n = vsnprintf(self->data + self->nchar, room, format, copy);
+        va_end(copy);
+        if (n < 0) {
+            return STL_String_encoding_error;
+        }
+
+        if ((size_t) n < room) {
+            self->nchar += n;
+            return STL_String_OK;
+        }
+
+        if (__STL_String_grow(self, self->nchar + n) != STL_String_OK) {
+            return STL_String_memory_error;
+        }
+    }
+
+    /* Returning value */
+    return STL_String_encoding_error;
+}
+
+int STL_String_vappendf(STL_String *self, const char *format, va_list args)
+{
+
+    /* VarCheck */
+    if (self == NULL || format == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto struct format_spec spec;
+    auto const char *p = format, *q;
+    auto size_t start = self->nchar;
+    auto va_list copy;
+    auto int code = STL_String_OK;
+
+    /* Main part */
+    if (self->charWidth != sizeof(char)) {
+        return STL_String_encoding_error;
+    }
+
+    if (__STL_String_prepare_write(self) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    if (strchr(format, '$') != NULL) {
+        code = STL_String_format_positional(self, format, args);
+    } else {
+        va_copy(copy, args);
+        while (*p != '\0' && code == STL_String_OK) {
+            for (q = p; *q != '\0' && *q != '%'; ++q)
+                ;
+            if (q != p) {
+                code = STL_String_format_raw(self, p, q - p);
+            }
+
+            if (*q == '\0' || code != STL_String_OK) {
+                break;
+            }
+
+            /* Malformed specifications are copied as they are */
+            if ((p = STL_String_format_parse(q + 1, &spec, &copy)) == NULL) {
+                code = STL_String_format_raw(self, q, 1);
+                p = q + 1;
+            } else {
+                code = STL_String_format_convert(self, &spec, &copy, start);
+            }
+        }
+        va_end(copy);
+    }
+
+    if (code != STL_String_OK) {
+        self->nchar = start;
+    }
+    if (self->data != NULL) {
+        ((char *) self->data)[self->nchar] = '\0';
+    }
+
+    /* Returning value */
+    return code;
+}
+
+int STL_String_appendf(STL_String *self, const char *format, ...)
+{
+
+    /* Initializing variables */
+    auto va_list args;
+    auto int code;
+
+    /* Main part */
+    va_start(args, format);
+    code = STL_String_vappendf(self, format, args);
+    va_end(args);
+
+    /* Returning value */
+    return code;
+}
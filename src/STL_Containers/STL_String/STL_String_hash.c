@@ -0,0 +1,236 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String.h"
+#include "../../STL_Headers/STL/STL_String_view.h"
+
+#include <string.h>
+
+/* wyhash-style mixing: 48 bytes per round in three independent lanes, 128-bit multiply folding */
+static const uint64_t secret[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull
+};
+
+static const uint64_t default_seed = 0x9e3779b97f4a7c15ull;
+
+static void STL_String_hash_mum(uint64_t *a, uint64_t *b)
+{
+
+#if defined(__SIZEOF_INT128__)
+    /* Initializing variables */
+    auto unsigned __int128 r = (unsigned __int128) *a * *b;
+
+    /* Main part */
+    *a = (uint64_t) r;
+    *b = (uint64_t) (r >> 64);
+#else
+    /* Initializing variables */
+    auto uint64_t ha = *a >> 32, hb = *b >> 32, la = (uint32_t) *a, lb = (uint32_t) *b;
+    auto uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb, t = rl + (rm0 << 32), c = t < rl;
+    auto uint64_t lo = t + (rm1 << 32);
+
+    /* Main part */
+    c += lo < t;
+    *a = lo;
+    *b = rh + (rm0 >> 32) + (rm1 >> 32) + c;
+#endif
+}
+
+static uint64_t STL_String_hash_mix(uint64_t a, uint64_t b)
+{
+
+    /* Main part */
+    STL_String_hash_mum(&a, &b);
+
+    /* Returning value */
+    return a ^ b;
+}
+
+static uint64_t STL_String_hash_r8(const unsigned char *p)
+{
+
+    /* Initializing variables */
+    auto uint64_t v;
+
+    /* Main part */
+    memcpy(&v, p, sizeof(v));
+
+    /* Returning value */
+    return v;
+}
+
+static uint64_t STL_String_hash_r4(const unsigned char *p)
+{
+
+    /* Initializing variables */
+    auto uint32_t v;
+
+    /* Main part */
+    memcpy(&v, p, sizeof(v));
+
+    /* Returning value */
+    return v;
+}
+
+static uint64_t STL_String_hash_bytes(const void *key, size_t len, uint64_t seed)
+{
+
+    /* Initializing variables */
+    auto const unsigned char *p = (const unsigned char *) key;
+    auto uint64_t a, b, see1, see2;
+    auto size_t i = len;
+
+    /* Main part */
+    seed ^= STL_String_hash_mix(seed ^ secret[0], secret[1]);
+
+    if (len <= 16) {
+        if (len >= 4) {
+            a = (STL_String_hash_r4(p) << 32) | STL_String_hash_r4(p + ((len >> 3) << 2));
+            b = (STL_String_hash_r4(p + len - 4) << 32) | STL_String_hash_r4(p + len - 4 - ((len >> 3) << 2));
+        } else if (len > 0) {
+            a = ((uint64_t) p[0] << 16) | ((uint64_t) p[len >> 1] << 8) | p[len - 1];
+            b = 0;
+        } else {
+            a = b = 0;
+        }
+    } else {
+        if (i > 48) {
+            see1 = see2 = seed;
+            do {
+                seed = STL_String_hash_mix(STL_String_hash_r8(p) ^ secret[1], STL_String_hash_r8(p + 8) ^ seed);
+                see1 = STL_String_hash_mix(STL_String_hash_r8(p + 16) ^ secret[2], STL_String_hash_r8(p + 24) ^ see1);
+                see2 = STL_String_hash_mix(STL_String_hash_r8(p + 32) ^ secret[3], STL_String_hash_r8(p + 40) ^ see2);
+                p += 48;
+                i -= 48;
+            } while (i > 48);
+            seed ^= see1 ^ see2;
+        }
+
+        while (i > 16) {
+            seed = STL_String_hash_mix(STL_String_hash_r8(p) ^ secret[1], STL_String_hash_r8(p + 8) ^ seed);
+            i -= 16;
+            p += 16;
+        }
+
+        a = STL_String_hash_r8(p + i - 16);
+        b = STL_String_hash_r8(p + i - 8);
+    }
+
+    a ^= secret[1];
+    b ^= seed;
+    STL_String_hash_mum(&a, &b);
+
+    /* Returning value */
+    return STL_String_hash_mix(a ^ secret[0] ^ len, b ^ secret[1]);
+}
+
+uint64_t STL_String_view_hash(const STL_String_view *self, uint64_t seed)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return 0;
+    }
+
+    /* Returning value */
+    return STL_String_hash_bytes(self->data, self->nchar, seed);
+}
+
+uint64_t STL_String_hash(STL_String *self)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return 0;
+    }
+
+    /* Main part */
+    if (!self->hash) {
+        STL_String_view_init_string(&view, self);
+        self->hash = STL_String_hash_bytes(view.data, view.nchar, default_seed);
+
+        /* Zero marks "not computed", so it is never a valid result */
+        self->hash += !self->hash;
+    }
+
+    /* Returning value */
+    return self->hash;
+}
+
+uint64_t STL_String_hash_seed(STL_String *self, uint64_t seed)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return 0;
+    }
+
+    /* Main part */
+    STL_String_view_init_string(&view, self);
+
+    /* Returning value */
+    return STL_String_view_hash(&view, seed);
+}
+
+int STL_String_view_equal(const STL_String_view *self, const STL_String_view *other)
+{
+
+    /* VarCheck */
+    if (self == NULL || other == NULL) {
+        return self == other;
+    }
+
+    /* Returning value */
+    return self->nchar == other->nchar && (self->data == other->data || !memcmp(self->data, other->data, self->nchar));
+}
+
+int STL_String_equal(STL_String *self, STL_String *other)
+{
+
+    /* Initializing variables */
+    auto STL_String_view a, b;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL) {
+        return self == other;
+    }
+
+    /* Main part */
+    if (self->nchar != other->nchar || self->charWidth != other->charWidth) {
+        return 0;
+    }
+
+    /* Two cached hashes settle most mismatches without touching the characters */
+    if (self->hash && other->hash && self->hash != other->hash) {
+        return 0;
+    }
+
+    STL_String_view_init_string(&a, self);
+    STL_String_view_init_string(&b, other);
+
+    /* Returning value */
+    return STL_String_view_equal(&a, &b);
+}
@@ -0,0 +1,36 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_STRING_INTERNAL_H
+#define SRC_STL_STRING_INTERNAL_H
+
+#include "../../STL_Headers/STL/STL_String.h"
+
+/* Routines shared between the STL_String translation units. Not a part of the public interface */
+int __STL_String_prepare_write(STL_String *self); /* Must be called before the characters of "self" change. Returns STL_String_OK if OK */
+int __STL_String_grow(STL_String *self, size_t nchar); /* Makes room for "nchar" characters plus the terminating zero */
+char *__STL_String_write_decimal(char *end,
+                                 unsigned long long value); /* Writes "value" backwards from "end". Returns its first character */
+void __STL_String_set_add(unsigned char *set, unsigned char *nibbles,
+                          unsigned char ch); /* Adds "ch" to a 32-byte bitmap and its 32-byte nibble table */
+size_t __STL_String_find_in_set(const unsigned char *set, const unsigned char *nibbles, const char *data,
+                                size_t count); /* Returns the offset of the first byte in the set, or "count" */
+
+#endif
@@ -0,0 +1,206 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String_map.h"
+#include "STL_String_internal.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifndef min
+#define min(x, y) ((x) < (y) ? (x) : (y))
+#endif
+
+static int STL_String_map_madvise(void *addr, size_t length, int advice)
+{
+
+    /* Initializing variables */
+    auto int flag;
+
+    /* Main part */
+    switch (advice) {
+        case STL_String_map_normal:
+            flag = MADV_NORMAL;
+            break;
+        case STL_String_map_sequential:
+            flag = MADV_SEQUENTIAL;
+            break;
+        case STL_String_map_random:
+            flag = MADV_RANDOM;
+            break;
+        case STL_String_map_willneed:
+            flag = MADV_WILLNEED;
+            break;
+        default:
+            return STL_String_index_error;
+    }
+
+    /* Hints that the kernel refuses are not errors */
+    if (length) {
+        madvise(addr, length, flag);
+    }
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_map_init(STL_String_map *self, int fd, size_t pos, size_t count, int advice)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto struct stat st;
+    auto size_t page = (size_t) sysconf(_SC_PAGESIZE), start;
+    auto void *addr;
+    auto int code;
+
+    /* Main part */
+    self->addr = NULL;
+    self->length = 0;
+    self->view.data = "";
+    self->view.nchar = 0;
+
+    /* The advice is checked on an empty range first, so a bad one never leaves a mapping behind */
+    if ((code = STL_String_map_madvise(NULL, 0, advice)) != STL_String_OK) {
+        return code;
+    }
+
+    if (fstat(fd, &st) < 0) {
+        return STL_String_io_error;
+    }
+
+    if (pos > (size_t) st.st_size) {
+        return STL_String_index_error;
+    }
+
+    /* mmap() wants a page-aligned offset, so the mapping may start a bit before "pos" */
+    count = min(count, (size_t) st.st_size - pos);
+    if (!count) {
+        return STL_String_OK;
+    }
+
+    start = pos - pos % page;
+    if ((addr = mmap(NULL, count + (pos - start), PROT_READ, MAP_PRIVATE, fd, (off_t) start)) == MAP_FAILED) {
+        return STL_String_io_error;
+    }
+
+    self->addr = addr;
+    self->length = count + (pos - start);
+    self->view.data = (const char *) addr + (pos - start);
+    self->view.nchar = count;
+
+    /* Returning value */
+    return STL_String_map_madvise(self->addr, self->length, advice);
+}
+
+int STL_String_map_open(STL_String_map *self, const char *path, int advice)
+{
+
+    /* VarCheck */
+    if (self == NULL || path == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto int fd, code;
+
+    /* Main part */
+    if ((fd = open(path, O_RDONLY)) < 0) {
+        return STL_String_io_error;
+    }
+
+    /* The mapping stays valid after the descriptor is closed */
+    code = STL_String_map_init(self, fd, 0, -1, advice);
+    close(fd);
+
+    /* Returning value */
+    return code;
+}
+
+void STL_String_map_delete(STL_String_map *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
+
+    /* Main part */
+    if (self->addr != NULL) {
+        munmap(self->addr, self->length);
+    }
+
+    self->addr = NULL;
+    self->length = 0;
+    self->view.data = "";
+    self->view.nchar = 0;
+}
+
+STL_String_view STL_String_map_view(const STL_String_map *self)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+    view.data = NULL;
+    view.nchar = 0;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return view;
+    }
+
+    /* Returning value */
+    return self->view;
+}
+
+int STL_String_map_advise(STL_String_map *self, size_t pos, size_t count, int advice)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    if (pos > self->view.nchar) {
+        return STL_String_index_error;
+    }
+
+    /* Initializing variables */
+    auto size_t page = (size_t) sysconf(_SC_PAGESIZE), start, end;
+
+    /* Main part */
+    if (self->addr == NULL) {
+        return STL_String_OK;
+    }
+
+    /* Rounded out to whole pages of the mapping */
+    start = (size_t) (self->view.data - (const char *) self->addr) + pos;
+    end = start + min(count, self->view.nchar - pos);
+    start -= start % page;
+
+    /* Returning value */
+    return STL_String_map_madvise((char *) self->addr + start, end - start, advice);
+}
@@ -0,0 +1,367 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String_matcher.h"
+#include "STL_String_internal.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+static const size_t thresh = 16;
+
+/* No pattern ends in the state */
+static const uint32_t none = 0xFFFFFFFF;
+
+/* Set in a transition when the target state has outputs */
+static const uint32_t output_flag = 0x80000000;
+
+#if defined(__SSSE3__)
+/* Skipping in the root state pays off only while the first bytes are rare */
+static const size_t max_prefilter_bytes = 16;
+#endif
+
+enum prefilter_kinds {
+    PREFILTER_NONE = 0,
+    PREFILTER_BYTE,
+    PREFILTER_SET
+};
+
+static void STL_String_matcher_free_automaton(STL_String_matcher *self)
+{
+
+    /* Main part */
+    free(self->delta);
+    free(self->out);
+    free(self->dict);
+    free(self->next);
+
+    self->delta = self->out = self->dict = self->next = NULL;
+    self->nstates = self->nclasses = 0;
+}
+
+int STL_String_matcher_init(STL_String_matcher *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    memset(self, 0, sizeof(*self));
+    self->chars = malloc(thresh);
+    self->offsets = malloc((thresh + 1) * sizeof(size_t));
+    if (self->chars == NULL || self->offsets == NULL) {
+        free(self->chars);
+        free(self->offsets);
+        return STL_String_memory_error;
+    }
+
+    self->max_nchars = self->max_npatterns = thresh;
+    self->offsets[0] = 0;
+
+    /* Returning value */
+    return STL_String_matcher_compile(self);
+}
+
+void STL_String_matcher_delete(STL_String_matcher *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
+
+    /* Main part */
+    STL_String_matcher_free_automaton(self);
+    free(self->chars);
+    free(self->offsets);
+    self->chars = NULL;
+    self->offsets = NULL;
+    self->nchars = self->npatterns = self->max_nchars = self->max_npatterns = 0;
+}
+
+int STL_String_matcher_add(STL_String_matcher *self, const char *pattern, size_t count)
+{
+
+    /* VarCheck */
+    if (self == NULL || pattern == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    if (!count) {
+        return STL_String_index_error;
+    }
+
+    /* Initializing variables */
+    auto size_t new_max;
+    auto void *tmp;
+
+    /* Main part */
+    if (self->nchars + count > self->max_nchars) {
+        for (new_max = self->max_nchars * 2; self->nchars + count > new_max; new_max *= 2)
+            ;
+        if ((tmp = realloc(self->chars, new_max)) == NULL) {
+            return STL_String_memory_error;
+        }
+        self->chars = tmp;
+        self->max_nchars = new_max;
+    }
+
+    if (self->npatterns == self->max_npatterns) {
+        if ((tmp = realloc(self->offsets, (self->max_npatterns * 2 + 1) * sizeof(size_t))) == NULL) {
+            return STL_String_memory_error;
+        }
+        self->offsets = tmp;
+        self->max_npatterns *= 2;
+    }
+
+    memcpy(self->chars + self->nchars, pattern, count);
+    self->nchars += count;
+    self->offsets[++self->npatterns] = self->nchars;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_matcher_compile(STL_String_matcher *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto const unsigned char *chars = (const unsigned char *) self->chars;
+    auto unsigned char used[256];
+    auto uint32_t *fail, *queue, *row, s, t, f;
+    auto size_t max_states = self->nchars + 1, nused = 0, nfirst = 0, p, i, c, head, tail;
+
+    /* Main part */
+    STL_String_matcher_free_automaton(self);
+
+    /* Bytes that appear in no pattern all behave the same and share class 0 */
+    memset(used, 0, sizeof(used));
+    for (i = 0; i < self->nchars; ++i) {
+        nused += !used[chars[i]];
+        used[chars[i]] = 1;
+    }
+
+    self->nclasses = (nused == 256) ? 0 : 1;
+    for (c = 0; c < 256; ++c) {
+        self->classes[c] = (unsigned char) (used[c] ? self->nclasses++ : 0);
+    }
+
+    if (max_states * self->nclasses >= output_flag) {
+        return STL_String_memory_error;
+    }
+
+    self->delta = calloc(max_states * self->nclasses, sizeof(uint32_t));
+    self->out = malloc(max_states * sizeof(uint32_t));
+    self->dict = calloc(max_states, sizeof(uint32_t));
+    self->next = malloc((self->npatterns + 1) * sizeof(uint32_t));
+    fail = malloc(max_states * sizeof(uint32_t));
+    queue = malloc(max_states * sizeof(uint32_t));
+    if (self->delta == NULL || self->out == NULL || self->dict == NULL || self->next == NULL || fail == NULL ||
+        queue == NULL) {
+        free(fail);
+        free(queue);
+        STL_String_matcher_free_automaton(self);
+        return STL_String_memory_error;
+    }
+    memset(self->out, 0xFF, max_states * sizeof(uint32_t));
+
+    /* Trie. The root is never a child, so 0 means "no edge yet" */
+    self->nstates = 1;
+    for (p = 0; p < self->npatterns; ++p) {
+        for (s = 0, i = self->offsets[p]; i < self->offsets[p + 1]; ++i) {
+            row = self->delta + s * self->nclasses + self->classes[chars[i]];
+            if (!*row) {
+                *row = (uint32_t) self->nstates++;
+            }
+            s = *row;
+        }
+        self->next[p] = self->out[s];
+        self->out[s] = (uint32_t) p;
+    }
+
+    /* Breadth-first, missing edges are copied from the failure state, whose row is already complete */
+    head = tail = 0;
+    fail[0] = 0;
+    for (c = 0; c < self->nclasses; ++c) {
+        if ((t = self->delta[c]) != 0) {
+            fail[t] = 0;
+            queue[tail++] = t;
+        }
+    }
+
+    while (head != tail) {
+        s = queue[head++];
+        f = fail[s];
+        for (c = 0; c < self->nclasses; ++c) {
+            row = self->delta + s * self->nclasses + c;
+            if (*row) {
+                t = *row;
+                fail[t] = self->delta[f * self->nclasses + c];
+                self->dict[t] = (self->out[fail[t]] != none) ? fail[t] : self->dict[fail[t]];
+                queue[tail++] = t;
+            } else {
+                *row = self->delta[f * self->nclasses + c];
+            }
+        }
+    }
+
+    free(fail);
+    free(queue);
+
+    /* Premultiplied targets save a multiplication per byte */
+    for (i = 0; i < self->nstates * self->nclasses; ++i) {
+        t = self->delta[i];
+        self->delta[i] = (uint32_t) (t * self->nclasses) |
+                         ((self->out[t] != none || self->dict[t]) ? output_flag : 0);
+    }
+
+    memset(self->first, 0, sizeof(self->first));
+    memset(self->nibbles, 0, sizeof(self->nibbles));
+    for (p = 0; p < self->npatterns; ++p) {
+        c = chars[self->offsets[p]];
+        nfirst += !((self->first[c >> 3] >> (c & 7)) & 1);
+        __STL_String_set_add(self->first, self->nibbles, (unsigned char) c);
+    }
+
+    if (nfirst == 1) {
+        self->prefilter = PREFILTER_BYTE;
+    } else {
+#if defined(__SSSE3__)
+        self->prefilter = (nfirst && nfirst <= max_prefilter_bytes) ? PREFILTER_SET : PREFILTER_NONE;
+#else
+        self->prefilter = PREFILTER_NONE;
+#endif
+    }
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+void STL_String_matcher_state_init(STL_String_matcher_state *state)
+{
+
+    /* VarCheck */
+    if (state == NULL) {
+        return;
+    }
+
+    /* Main part */
+    state->state = 0;
+    state->offset = 0;
+}
+
+int STL_String_matcher_feed(const STL_String_matcher *self, STL_String_matcher_state *state, const char *data,
+                            size_t count, int (*callback)(size_t pattern, size_t pos, void *arg), void *arg)
+{
+
+    /* VarCheck */
+    if (self == NULL || self->delta == NULL || state == NULL || (data == NULL && count) || callback == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    register const unsigned char *iter = (const unsigned char *) data, *end = iter + count;
+    register const uint32_t *delta = self->delta;
+    register uint32_t s = state->state;
+    auto const void *found;
+    auto uint32_t t, p;
+    auto size_t pos;
+
+    /* Main part */
+    while (iter != end) {
+        /* Bytes that start no pattern keep the root state, so they are skipped in bulk */
+        if (!s && self->prefilter != PREFILTER_NONE) {
+            if (self->prefilter == PREFILTER_BYTE) {
+                found = memchr(iter, self->chars[0], end - iter);
+                iter = (found != NULL) ? (const unsigned char *) found : end;
+            } else {
+                iter += __STL_String_find_in_set(self->first, self->nibbles, (const char *) iter, end - iter);
+            }
+
+            if (iter == end) {
+                break;
+            }
+        }
+
+        s = delta[(s & ~output_flag) + self->classes[*iter++]];
+        if (!(s & output_flag)) {
+            continue;
+        }
+
+        pos = state->offset + (size_t) (iter - (const unsigned char *) data);
+        for (t = (s & ~output_flag) / (uint32_t) self->nclasses; t; t = self->dict[t]) {
+            for (p = self->out[t]; p != none; p = self->next[p]) {
+                if (callback(p, pos - (self->offsets[p + 1] - self->offsets[p]), arg)) {
+                    state->state = s;
+                    state->offset += iter - (const unsigned char *) data;
+                    return STL_String_OK;
+                }
+            }
+        }
+    }
+
+    state->state = s;
+    state->offset += count;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_matcher_scan_view(const STL_String_matcher *self, const STL_String_view *view,
+                                 int (*callback)(size_t pattern, size_t pos, void *arg), void *arg)
+{
+
+    /* Initializing variables */
+    auto STL_String_matcher_state state;
+
+    /* VarCheck */
+    if (view == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    STL_String_matcher_state_init(&state);
+
+    /* Returning value */
+    return STL_String_matcher_feed(self, &state, view->data, view->nchar, callback, arg);
+}
+
+int STL_String_matcher_scan(const STL_String_matcher *self, STL_String *str,
+                            int (*callback)(size_t pattern, size_t pos, void *arg), void *arg)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (STL_String_view_init_string(&view, str) != STL_String_OK) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_matcher_scan_view(self, &view, callback, arg);
+}
@@ -0,0 +1,750 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String.h"
+#include "../../STL_Headers/STL/STL_String_view.h"
+#include "STL_String_internal.h"
+#include "STL_String_number_tables.h"
+
+#include <locale.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const int smallest_pow5 = -342;
+static const int largest_pow5 = 308;
+static const int smallest_pow10 = -292;
+
+/* Decimal digits an uint64_t always holds */
+static const int max_digits = 19;
+
+static const double exact_pow10[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static const uint64_t mantissa_mask = 0x000FFFFFFFFFFFFFULL;
+static const uint64_t hidden_bit = 0x0010000000000000ULL;
+static const uint64_t infinity_bits = 0x7FF0000000000000ULL;
+
+static void STL_String_number_mul128(uint64_t a, uint64_t b, uint64_t *lo, uint64_t *hi)
+{
+
+    /* Main part */
+#if defined(__SIZEOF_INT128__)
+    auto unsigned __int128 r = (unsigned __int128) a * b;
+
+    *lo = (uint64_t) r;
+    *hi = (uint64_t) (r >> 64);
+#else
+    auto uint64_t a_lo = (uint32_t) a, a_hi = a >> 32, b_lo = (uint32_t) b, b_hi = b >> 32;
+    auto uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+    auto uint64_t mid = (ll >> 32) + (uint32_t) lh + (uint32_t) hl;
+
+    *lo = (mid << 32) | (uint32_t) ll;
+    *hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+static int STL_String_number_is_digit(char ch)
+{
+
+    /* Returning value */
+    return (unsigned) (ch - '0') < 10u;
+}
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define STL_STRING_SWAR_DIGITS
+#endif
+
+#if defined(STL_STRING_SWAR_DIGITS)
+static int STL_String_number_eight_digits(const char *p)
+{
+
+    /* Initializing variables */
+    auto uint64_t v;
+
+    /* Main part */
+    memcpy(&v, p, sizeof(v));
+
+    /* Returning value */
+    return (((v & 0xF0F0F0F0F0F0F0F0ULL) | (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) ==
+            0x3333333333333333ULL);
+}
+
+static uint64_t STL_String_number_parse_eight(const char *p)
+{
+
+    /* Eight ASCII digits at once: pairs, then quads, then the whole word */
+
+    /* Initializing variables */
+    auto uint64_t v;
+
+    /* Main part */
+    memcpy(&v, p, sizeof(v));
+    v -= 0x3030303030303030ULL;
+    v = (v * 10) + (v >> 8);
+    v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+         (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+
+    /* Returning value */
+    return (uint32_t) v;
+}
+#endif
+
+static const char *STL_String_number_digits(const char *p, const char *end, uint64_t *value, int *overflow)
+{
+
+    /* Accumulates a run of digits. On overflow the rest of the run is still consumed */
+
+    /* Initializing variables */
+    auto uint64_t v = 0, d;
+
+    /* Main part */
+    *overflow = 0;
+#if defined(STL_STRING_SWAR_DIGITS)
+    while (end - p >= 8 && v <= 99999999999ULL && STL_String_number_eight_digits(p)) {
+        v = v * 100000000 + STL_String_number_parse_eight(p);
+        p += 8;
+    }
+#endif
+
+    for (; p != end && STL_String_number_is_digit(*p); ++p) {
+        d = (uint64_t) (*p - '0');
+        if (v > (UINT64_MAX - d) / 10) {
+            *overflow = 1;
+        }
+        v = v * 10 + d;
+    }
+
+    *value = v;
+
+    /* Returning value */
+    return p;
+}
+
+int STL_String_view_parse_ullong(const STL_String_view *self, unsigned long long *value, size_t *nparsed)
+{
+
+    /* VarCheck */
+    if (self == NULL || value == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto const char *p = self->data, *end = self->data + self->nchar, *digits;
+    auto uint64_t v;
+    auto int overflow;
+
+    /* Main part */
+    if (p != end && *p == '+') {
+        ++p;
+    }
+
+    digits = p;
+    p = STL_String_number_digits(p, end, &v, &overflow);
+    if (p == digits) {
+        *value = 0;
+        if (nparsed != NULL) {
+            *nparsed = 0;
+        }
+        return STL_String_parse_error;
+    }
+
+    *value = (overflow) ? (unsigned long long) UINT64_MAX : v;
+    if (nparsed != NULL) {
+        *nparsed = p - self->data;
+    }
+
+    /* Returning value */
+    return (overflow) ? STL_String_range_error : STL_String_OK;
+}
+
+int STL_String_view_parse_llong(const STL_String_view *self, long long *value, size_t *nparsed)
+{
+
+    /* VarCheck */
+    if (self == NULL || value == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto const char *p = self->data, *end = self->data + self->nchar, *digits;
+    auto uint64_t v, limit;
+    auto int overflow, negative = 0;
+
+    /* Main part */
+    if (p != end && (*p == '+' || *p == '-')) {
+        negative = (*p++ == '-');
+    }
+
+    digits = p;
+    p = STL_String_number_digits(p, end, &v, &overflow);
+    if (p == digits) {
+        *value = 0;
+        if (nparsed != NULL) {
+            *nparsed = 0;
+        }
+        return STL_String_parse_error;
+    }
+
+    limit = (uint64_t) INT64_MAX + negative;
+    if (overflow || v > limit) {
+        overflow = 1;
+        v = limit;
+    }
+
+    *value = (negative) ? (long long) (0 - v) : (long long) v;
+    if (nparsed != NULL) {
+        *nparsed = p - self->data;
+    }
+
+    /* Returning value */
+    return (overflow) ? STL_String_range_error : STL_String_OK;
+}
+
+static uint64_t STL_String_number_eisel_lemire(uint64_t w, int q)
+{
+
+    /* Correctly rounded w * 10^q as binary64 bits without the sign (Lemire, "Number Parsing at a Gigabyte per Second");
+     * the 128-bit product is always sufficient (Mushtak & Lemire, "Fast Number Parsing Without Fallback") */
+
+    /* Initializing variables */
+    auto const uint64_t *pow5;
+    auto uint64_t lo, hi, lo2, hi2, mantissa;
+    auto int lz = 0, upperbit, shift, power2;
+
+    /* Main part */
+    if (w == 0 || q < smallest_pow5) {
+        return 0;
+    } else if (q > largest_pow5) {
+        return infinity_bits;
+    }
+
+    while (!(w >> 63)) {
+        w <<= 1;
+        ++lz;
+    }
+
+    pow5 = pow5_128 + 2 * (q - smallest_pow5);
+    STL_String_number_mul128(w, pow5[0], &lo, &hi);
+    if ((hi & 0x1FF) == 0x1FF) {
+        STL_String_number_mul128(w, pow5[1], &lo2, &hi2);
+        lo += hi2;
+        hi += (hi2 > lo);
+    }
+
+    upperbit = (int) (hi >> 63);
+    shift = upperbit + 64 - 52 - 3;
+    mantissa = hi >> shift;
+    power2 = (((152170 + 65536) * q) >> 16) + 63 + upperbit - lz + 1023;
+
+    if (power2 <= 0) {
+        if (-power2 + 1 >= 64) {
+            return 0;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += (mantissa & 1);
+        mantissa >>= 1;
+
+        /* Rounding may carry into the smallest normal exponent */
+        return mantissa;
+    }
+
+    /* Exactly halfway: round to even */
+    if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == hi) {
+        mantissa &= ~(uint64_t) 1;
+    }
+
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    if (mantissa >= (hidden_bit << 1)) {
+        mantissa = hidden_bit;
+        ++power2;
+    }
+
+    if (power2 >= 0x7FF) {
+        return infinity_bits;
+    }
+
+    /* Returning value */
+    return (mantissa & mantissa_mask) | ((uint64_t) power2 << 52);
+}
+
+static double STL_String_number_strtod(const char *str, size_t count)
+{
+
+    /* Rare inputs are left to strtod(), with the '.' swapped for the decimal point of the current locale */
+
+    /* Initializing variables */
+    auto const char *point = localeconv()->decimal_point;
+    auto size_t npoint = strlen(point), i, j;
+    auto char buf[128], *copy = buf;
+    auto double value;
+
+    /* Main part */
+    if (count * npoint + 1 > sizeof(buf) && (copy = malloc(count * npoint + 1)) == NULL) {
+        return 0.0;
+    }
+
+    for (i = j = 0; i < count; ++i) {
+        if (str[i] == '.') {
+            memcpy(copy + j, point, npoint);
+            j += npoint;
+        } else {
+            copy[j++] = str[i];
+        }
+    }
+    copy[j] = '\0';
+
+    value = strtod(copy, NULL);
+    if (copy != buf) {
+        free(copy);
+    }
+
+    /* Returning value */
+    return value;
+}
+
+static size_t STL_String_number_special(const char *p, const char *end, double *value)
+{
+
+    /* Matches "inf", "infinity" and "nan" in any case. Returns the length matched */
+
+    /* Initializing variables */
+    auto size_t n = end - p, i;
+    auto const char *word = NULL;
+    auto uint64_t bits;
+
+    /* Main part */
+    if (n >= 3) {
+        for (i = 0; i < 3 && (p[i] | 0x20) == "inf"[i]; ++i)
+            ;
+        if (i == 3) {
+            word = "infinity";
+            bits = infinity_bits;
+        }
+
+        for (i = 0; i < 3 && (p[i] | 0x20) == "nan"[i]; ++i)
+            ;
+        if (i == 3) {
+            word = "nan";
+            bits = 0x7FF8000000000000ULL;
+        }
+    }
+
+    if (word == NULL) {
+        return 0;
+    }
+
+    memcpy(value, &bits, sizeof(bits));
+
+    /* Returning value */
+    if (word[3] != '\0') {
+        for (i = 3; i < 8 && i < n && (p[i] | 0x20) == word[i]; ++i)
+            ;
+        return (i == 8) ? 8 : 3;
+    }
+    return 3;
+}
+
+int STL_String_view_parse_double(const STL_String_view *self, double *value, size_t *nparsed)
+{
+
+    /* VarCheck */
+    if (self == NULL || value == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto const char *p = self->data, *end = self->data + self->nchar, *start;
+    auto uint64_t w = 0, bits, bits_up;
+    auto int negative = 0, ndigits = 0, truncated = 0, any = 0, exp_negative = 0, q;
+    auto long exp10 = 0, exp_value = 0;
+    auto size_t nspecial;
+    auto double result;
+
+    /* Main part */
+    if (p != end && (*p == '+' || *p == '-')) {
+        negative = (*p++ == '-');
+    }
+
+    if ((nspecial = STL_String_number_special(p, end, &result)) != 0) {
+        p += nspecial;
+        *value = (negative) ? -result : result;
+        if (nparsed != NULL) {
+            *nparsed = p - self->data;
+        }
+        return STL_String_OK;
+    }
+
+    /* Up to 19 significant digits go to w; dropped integer digits scale it, nonzero dropped ones make it inexact */
+    for (; p != end && *p == '0'; ++p) {
+        any = 1;
+    }
+    for (; p != end && STL_String_number_is_digit(*p); ++p, any = 1) {
+#if defined(STL_STRING_SWAR_DIGITS)
+        if (ndigits + 8 <= max_digits && end - p >= 8 && STL_String_number_eight_digits(p)) {
+            w = w * 100000000 + STL_String_number_parse_eight(p);
+            ndigits += 8;
+            p += 7;
+            continue;
+        }
+#endif
+        if (ndigits < max_digits) {
+            w = w * 10 + (uint64_t) (*p - '0');
+            ++ndigits;
+        } else {
+            truncated |= (*p != '0');
+            ++exp10;
+        }
+    }
+
+    if (p != end && *p == '.') {
+        ++p;
+        if (!ndigits) {
+            for (; p != end && *p == '0'; ++p, any = 1) {
+                --exp10;
+            }
+        }
+        for (; p != end && STL_String_number_is_digit(*p); ++p, any = 1) {
+#if defined(STL_STRING_SWAR_DIGITS)
+            if (ndigits + 8 <= max_digits && end - p >= 8 && STL_String_number_eight_digits(p)) {
+                w = w * 100000000 + STL_String_number_parse_eight(p);
+                ndigits += 8;
+                exp10 -= 8;
+                p += 7;
+                continue;
+            }
+#endif
+            if (ndigits < max_digits) {
+                w = w * 10 + (uint64_t) (*p - '0');
+                ++ndigits;
+                --exp10;
+            } else {
+                truncated |= (*p != '0');
+            }
+        }
+    }
+
+    if (!any) {
+        *value = 0.0;
+        if (nparsed != NULL) {
+            *nparsed = 0;
+        }
+        return STL_String_parse_error;
+    }
+
+    if (p != end && (*p | 0x20) == 'e') {
+        start = p++;
+        if (p != end && (*p == '+' || *p == '-')) {
+            exp_negative = (*p++ == '-');
+        }
+
+        if (p == end || !STL_String_number_is_digit(*p)) {
+            p = start;
+        } else {
+            for (; p != end && STL_String_number_is_digit(*p); ++p) {
+                if (exp_value < 100000) {
+                    exp_value = exp_value * 10 + (*p - '0');
+                }
+            }
+        }
+    }
+
+    exp10 += (exp_negative) ? -exp_value : exp_value;
+    q = (exp10 < -100000) ? -100000 : (exp10 > 100000) ? 100000 : (int) exp10;
+
+    if (nparsed != NULL) {
+        *nparsed = p - self->data;
+    }
+
+    if (!truncated && w <= hidden_bit << 1 && q >= -22 && q <= 22) {
+        /* Clinger's fast path: both operands and the result are exact up to one rounding */
+        result = (q < 0) ? (double) w / exact_pow10[-q] : (double) w * exact_pow10[q];
+    } else {
+        bits = STL_String_number_eisel_lemire(w, q);
+
+        /* Truncated digits put the value between w and w + 1; both must round the same way */
+        if (truncated && (bits_up = STL_String_number_eisel_lemire(w + 1, q)) != bits) {
+            result = STL_String_number_strtod(self->data + negative, p - self->data - negative);
+        } else {
+            memcpy(&result, &bits, sizeof(bits));
+        }
+    }
+
+    *value = (negative) ? -result : result;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_parse_llong(STL_String *self, long long *value, size_t *nparsed)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (STL_String_view_init_string(&view, self) != STL_String_OK) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_parse_llong(&view, value, nparsed);
+}
+
+int STL_String_parse_ullong(STL_String *self, unsigned long long *value, size_t *nparsed)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (STL_String_view_init_string(&view, self) != STL_String_OK) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_parse_ullong(&view, value, nparsed);
+}
+
+int STL_String_parse_double(STL_String *self, double *value, size_t *nparsed)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (STL_String_view_init_string(&view, self) != STL_String_OK) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_parse_double(&view, value, nparsed);
+}
+
+static int STL_String_number_append(STL_String *self, const char *str, size_t count)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    if (self->charWidth != sizeof(char)) {
+        return STL_String_encoding_error;
+    }
+
+    /* Main part */
+    if (__STL_String_prepare_write(self) != STL_String_OK ||
+        __STL_String_grow(self, self->nchar + count) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    memcpy((char *) self->data + self->nchar, str, count);
+    self->nchar += count;
+    ((char *) self->data)[self->nchar] = '\0';
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_append_ullong(STL_String *self, unsigned long long value)
+{
+
+    /* Initializing variables */
+    auto char buf[24], *start = __STL_String_write_decimal(buf + sizeof(buf), value);
+
+    /* Returning value */
+    return STL_String_number_append(self, start, buf + sizeof(buf) - start);
+}
+
+int STL_String_append_llong(STL_String *self, long long value)
+{
+
+    /* Initializing variables */
+    auto char buf[24], *start;
+
+    /* Main part */
+    start = __STL_String_write_decimal(buf + sizeof(buf), (value < 0) ? 0 - (unsigned long long) value
+                                                                      : (unsigned long long) value);
+    if (value < 0) {
+        *--start = '-';
+    }
+
+    /* Returning value */
+    return STL_String_number_append(self, start, buf + sizeof(buf) - start);
+}
+
+static uint64_t STL_String_number_round_to_odd(const uint64_t *g, uint64_t cp)
+{
+
+    /* Initializing variables */
+    auto uint64_t x_lo, x_hi, y_lo, y_hi;
+
+    /* Main part */
+    STL_String_number_mul128(g[1], cp, &x_lo, &x_hi);
+    STL_String_number_mul128(g[0], cp, &y_lo, &y_hi);
+    y_lo += x_hi;
+    y_hi += (y_lo < x_hi);
+
+    /* Returning value */
+    return y_hi | (y_lo > 1);
+}
+
+static uint64_t STL_String_number_shortest(uint64_t significand, int exponent, int *exp10)
+{
+
+    /* Shortest decimal in the rounding interval of a finite positive double (Giulietti's Schubfach) */
+
+    /* Initializing variables */
+    auto uint64_t m2, cbl, cb, cbr, vbl, vb, vbr, lower, upper, s, sp;
+    auto int e2, k, h, even, closer, u_inside, w_inside;
+    auto const uint64_t *g;
+
+    /* Main part */
+    if (exponent != 0) {
+        m2 = hidden_bit | significand;
+        e2 = exponent - 1075;
+    } else {
+        m2 = significand;
+        e2 = 1 - 1075;
+    }
+
+    even = !(m2 & 1);
+    closer = (significand == 0 && exponent > 1);
+
+    cbl = 4 * m2 - 2 + closer;
+    cb = 4 * m2;
+    cbr = 4 * m2 + 2;
+
+    /* floor(log10(3/4 * 2^e2)) or floor(log10(2^e2)), and h = e2 + floor(log2(10^-k)) + 1 */
+    k = (closer) ? (e2 * 1262611 - 524031) >> 22 : (e2 * 1262611) >> 22;
+    h = e2 + ((-k * 1741647) >> 19) + 1;
+    g = pow10_128 + 2 * (-k - smallest_pow10);
+
+    vbl = STL_String_number_round_to_odd(g, cbl << h);
+    vb = STL_String_number_round_to_odd(g, cb << h);
+    vbr = STL_String_number_round_to_odd(g, cbr << h);
+
+    lower = vbl + !even;
+    upper = vbr - !even;
+
+    s = vb / 4;
+    if (s >= 10) {
+        sp = s / 10;
+        u_inside = (lower <= 40 * sp);
+        w_inside = (40 * sp + 40 <= upper);
+        if (u_inside != w_inside) {
+            *exp10 = k + 1;
+            return sp + w_inside;
+        }
+    }
+
+    u_inside = (lower <= 4 * s);
+    w_inside = (4 * s + 4 <= upper);
+    *exp10 = k;
+    if (u_inside != w_inside) {
+        return s + w_inside;
+    }
+
+    /* Returning value */
+    return s + (vb > 4 * s + 2 || (vb == 4 * s + 2 && (s & 1)));
+}
+
+int STL_String_append_double(STL_String *self, double value)
+{
+
+    /* Initializing variables */
+    auto char buf[40], digits[24], *p = buf, *start;
+    auto uint64_t bits, d;
+    auto int exponent, exp10, n, x, i;
+
+    /* Main part */
+    memcpy(&bits, &value, sizeof(bits));
+    if (bits >> 63) {
+        *p++ = '-';
+    }
+
+    exponent = (int) ((bits >> 52) & 0x7FF);
+    if (exponent == 0x7FF) {
+        return (bits & mantissa_mask) ? STL_String_number_append(self, "nan", 3)
+                                      : STL_String_number_append(self, (bits >> 63) ? "-inf" : "inf", 3 + (p != buf));
+    }
+
+    if (!(bits << 1)) {
+        *p++ = '0';
+        return STL_String_number_append(self, buf, p - buf);
+    }
+
+    d = STL_String_number_shortest(bits & mantissa_mask, exponent, &exp10);
+    for (; d % 10 == 0; d /= 10) {
+        ++exp10;
+    }
+
+    start = __STL_String_write_decimal(digits + sizeof(digits), d);
+    n = (int) (digits + sizeof(digits) - start);
+    x = exp10 + n - 1;
+
+    /* Plain notation for decimal exponents in [-4, 16), scientific otherwise */
+    if (x >= -4 && x < 16) {
+        if (x < 0) {
+            *p++ = '0';
+            *p++ = '.';
+            for (i = x; i < -1; ++i) {
+                *p++ = '0';
+            }
+            memcpy(p, start, n);
+            p += n;
+        } else if (x + 1 >= n) {
+            memcpy(p, start, n);
+            p += n;
+            for (i = n; i <= x; ++i) {
+                *p++ = '0';
+            }
+        } else {
+            memcpy(p, start, x + 1);
+            p += x + 1;
+            *p++ = '.';
+            memcpy(p, start + x + 1, n - x - 1);
+            p += n - x - 1;
+        }
+    } else {
+        *p++ = start[0];
+        if (n > 1) {
+            *p++ = '.';
+            memcpy(p, start + 1, n - 1);
+            p += n - 1;
+        }
+
+        *p++ = 'e';
+        *p++ = (x < 0) ? '-' : '+';
+        x = (x < 0) ? -x : x;
+        if (x < 10) {
+            *p++ = '0';
+        }
+        start = __STL_String_write_decimal(digits + sizeof(digits), (unsigned long long) x);
+        memcpy(p, start, digits + sizeof(digits) - start);
+        p += digits + sizeof(digits) - start;
+    }
+
+    /* Returning value */
+    return STL_String_number_append(self, buf, p - buf);
+}
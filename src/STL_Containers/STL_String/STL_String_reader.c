@@ -0,0 +1,190 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String_reader.h"
+#include "STL_String_internal.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+static const size_t default_bufsize = 64 * 1024;
+
+static int STL_String_reader_fill(STL_String_reader *self)
+{
+
+    /* Initializing variables */
+    auto char *tmp;
+    auto ssize_t n;
+
+    /* Main part */
+    if (self->begin) {
+        memmove(self->buf, self->buf + self->begin, self->end - self->begin);
+        self->end -= self->begin;
+        self->begin = 0;
+    }
+
+    /* Only a line longer than the whole buffer gets here with no room left */
+    if (self->end == self->max_nchar) {
+        if ((tmp = realloc(self->buf, self->max_nchar * 2)) == NULL) {
+            return STL_String_memory_error;
+        }
+        self->buf = tmp;
+        self->max_nchar *= 2;
+    }
+
+    do {
+        n = read(self->fd, self->buf + self->end, self->max_nchar - self->end);
+    } while (n < 0 && errno == EINTR);
+
+    if (n < 0) {
+        return STL_String_io_error;
+    }
+
+    self->end += n;
+    self->eof = (n == 0);
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_reader_init(STL_String_reader *self, int fd, size_t bufsize)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    self->max_nchar = (bufsize) ? bufsize : default_bufsize;
+    if ((self->buf = malloc(self->max_nchar)) == NULL) {
+        return STL_String_memory_error;
+    }
+
+    self->begin = self->end = self->scanned = 0;
+    self->fd = fd;
+    self->eof = 0;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+void STL_String_reader_delete(STL_String_reader *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
+
+    /* Main part */
+    free(self->buf);
+    self->buf = NULL;
+    self->begin = self->end = self->scanned = self->max_nchar = 0;
+}
+
+int STL_String_reader_getline(STL_String_reader *self, STL_String_view *line)
+{
+
+    /* VarCheck */
+    if (self == NULL || line == NULL || self->buf == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto const char *nl;
+    auto int code;
+
+    /* Main part */
+    for (;;) {
+        /* libc's memchr() is already vectorized; bytes searched before a refill aren't searched again */
+        nl = memchr(self->buf + self->begin + self->scanned, '\n', self->end - self->begin - self->scanned);
+        if (nl != NULL) {
+            line->data = self->buf + self->begin;
+            line->nchar = nl - line->data;
+            self->begin = nl + 1 - self->buf;
+            self->scanned = 0;
+            return STL_String_OK;
+        }
+        self->scanned = self->end - self->begin;
+
+        if (self->eof) {
+            if (self->begin == self->end) {
+                return STL_String_end_of_file;
+            }
+
+            line->data = self->buf + self->begin;
+            line->nchar = self->end - self->begin;
+            self->begin = self->end;
+            self->scanned = 0;
+            return STL_String_OK;
+        }
+
+        if ((code = STL_String_reader_fill(self)) != STL_String_OK) {
+            return code;
+        }
+    }
+}
+
+int STL_String_reader_append_line(STL_String_reader *self, STL_String *line)
+{
+
+    /* VarCheck */
+    if (self == NULL || line == NULL || self->buf == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto const char *nl;
+    auto size_t count;
+    auto int code, found = 0;
+
+    /* Main part */
+    for (;;) {
+        nl = memchr(self->buf + self->begin, '\n', self->end - self->begin);
+        count = (nl != NULL) ? (size_t) (nl - self->buf) - self->begin : self->end - self->begin;
+
+        /* Long lines are streamed into the string chunk by chunk instead of growing the buffer */
+        if (count) {
+            if (__STL_String_grow(line, line->nchar + count) != STL_String_OK) {
+                return STL_String_memory_error;
+            }
+            STL_String_append_str_n(line, self->buf + self->begin, count);
+            found = 1;
+        }
+        self->begin += count;
+        self->scanned = 0;
+
+        if (nl != NULL) {
+            ++self->begin;
+            return STL_String_OK;
+        }
+
+        if (self->eof) {
+            return (found) ? STL_String_OK : STL_String_end_of_file;
+        }
+
+        if ((code = STL_String_reader_fill(self)) != STL_String_OK) {
+            return code;
+        }
+    }
+}
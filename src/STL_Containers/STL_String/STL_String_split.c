@@ -0,0 +1,287 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String_split.h"
+#include "STL_String_internal.h"
+
+#include <string.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static size_t STL_String_split_scan_char(const STL_String_tokenizer *self, size_t pos)
+{
+
+    /* Initializing variables */
+    auto const char *found = memchr(self->src.data + pos, self->delim[0], self->src.nchar - pos);
+
+    /* Returning value */
+    return (found != NULL) ? (size_t) (found - self->src.data) : self->src.nchar;
+}
+
+static size_t STL_String_split_scan_str(const STL_String_tokenizer *self, size_t pos)
+{
+
+    /* Initializing variables */
+    register const char *iter = self->src.data + pos, *end = self->src.data + self->src.nchar;
+    auto const size_t len = self->delim_len;
+#if defined(__SSE2__)
+    auto __m128i first, last;
+    auto unsigned mask;
+#endif
+
+    /* Main part */
+#if defined(__SSE2__)
+    /* Only positions where both the first and the last delimiter characters match are compared in full */
+    first = _mm_set1_epi8(self->delim[0]);
+    last = _mm_set1_epi8(self->delim[len - 1]);
+    for (; (size_t) (end - iter) >= 16 + len - 1; iter += 16) {
+        mask = (unsigned) _mm_movemask_epi8(
+                _mm_and_si128(_mm_cmpeq_epi8(first, _mm_loadu_si128((const __m128i *) iter)),
+                              _mm_cmpeq_epi8(last, _mm_loadu_si128((const __m128i *) (iter + len - 1)))));
+        for (; mask; mask &= mask - 1) {
+            if (!memcmp(iter + __builtin_ctz(mask) + 1, self->delim + 1, len - 2)) {
+                return iter + __builtin_ctz(mask) - self->src.data;
+            }
+        }
+    }
+#endif
+
+    while ((size_t) (end - iter) >= len && (iter = memchr(iter, self->delim[0], end - iter - len + 1)) != NULL) {
+        if (!memcmp(iter + 1, self->delim + 1, len - 1)) {
+            return iter - self->src.data;
+        }
+        ++iter;
+    }
+
+    /* Returning value */
+    return self->src.nchar;
+}
+
+void __STL_String_set_add(unsigned char *set, unsigned char *nibbles, unsigned char ch)
+{
+
+    /* Main part */
+    set[ch >> 3] |= (unsigned char) (1u << (ch & 7));
+    nibbles[(ch >> 7) * 16 + (ch & 15)] |= (unsigned char) (1u << ((ch >> 4) & 7));
+}
+
+size_t __STL_String_find_in_set(const unsigned char *set, const unsigned char *nibbles, const char *data, size_t count)
+{
+
+    /* Initializing variables */
+    register const unsigned char *iter = (const unsigned char *) data;
+    auto const unsigned char *end = iter + count;
+#if defined(__SSSE3__)
+    auto __m128i lo, hi, bits, chunk, row, bit;
+    auto unsigned mask;
+#endif
+
+    /* Main part */
+#if defined(__SSSE3__)
+    /* Every byte picks its row by the low nibble and its bit by the high one (Mula's pshufb lookup) */
+    lo = _mm_loadu_si128((const __m128i *) nibbles);
+    hi = _mm_loadu_si128((const __m128i *) (nibbles + 16));
+    bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+    for (; end - iter >= 16; iter += 16) {
+        chunk = _mm_loadu_si128((const __m128i *) iter);
+        row = _mm_or_si128(_mm_shuffle_epi8(lo, chunk),
+                           _mm_shuffle_epi8(hi, _mm_xor_si128(chunk, _mm_set1_epi8(-128))));
+        bit = _mm_shuffle_epi8(bits, _mm_and_si128(_mm_srli_epi16(chunk, 4), _mm_set1_epi8(0x0F)));
+        mask = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(row, bit), bit));
+        if (mask) {
+            return (const char *) iter + __builtin_ctz(mask) - data;
+        }
+    }
+#else
+    (void) nibbles;
+#endif
+
+    for (; iter != end; ++iter) {
+        if ((set[*iter >> 3] >> (*iter & 7)) & 1) {
+            return (const char *) iter - data;
+        }
+    }
+
+    /* Returning value */
+    return count;
+}
+
+static size_t STL_String_split_scan_any(const STL_String_tokenizer *self, size_t pos)
+{
+
+    /* Initializing variables */
+    register const char *iter = self->src.data + pos;
+    auto const char *end = self->src.data + self->src.nchar;
+#if defined(__SSE2__) && !defined(__SSSE3__)
+    auto __m128i d0, d1, d2, d3, chunk;
+    auto unsigned mask;
+#endif
+
+    /* Main part */
+#if defined(__SSE2__) && !defined(__SSSE3__)
+    /* Without pshufb, small sets are still matched 16 bytes at a time with broadcast compares */
+    if (self->delim_len <= 4) {
+        d0 = _mm_set1_epi8(self->delim[0]);
+        d1 = _mm_set1_epi8(self->delim[(self->delim_len > 1) ? 1 : 0]);
+        d2 = _mm_set1_epi8(self->delim[(self->delim_len > 2) ? 2 : 0]);
+        d3 = _mm_set1_epi8(self->delim[(self->delim_len > 3) ? 3 : 0]);
+        for (; end - iter >= 16; iter += 16) {
+            chunk = _mm_loadu_si128((const __m128i *) iter);
+            mask = (unsigned) _mm_movemask_epi8(
+                    _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, d0), _mm_cmpeq_epi8(chunk, d1)),
+                                 _mm_or_si128(_mm_cmpeq_epi8(chunk, d2), _mm_cmpeq_epi8(chunk, d3))));
+            if (mask) {
+                return iter + __builtin_ctz(mask) - self->src.data;
+            }
+        }
+    }
+#endif
+
+    /* Returning value */
+    return iter - self->src.data + __STL_String_find_in_set(self->set, self->nibbles, iter, end - iter);
+}
+
+int STL_String_tokenizer_init(STL_String_tokenizer *self, const STL_String_view *src, const char *delim,
+                              size_t delim_len, int mode, int skip_empty)
+{
+
+    /* VarCheck */
+    if (self == NULL || src == NULL || (delim == NULL && delim_len)) {
+        return STL_String_null_reference_error;
+    }
+    if (mode < STL_String_split_char || mode > STL_String_split_any || (mode == STL_String_split_char && delim_len != 1)) {
+        return STL_String_index_error;
+    }
+
+    /* Initializing variables */
+    auto const unsigned char *iter;
+
+    /* Main part */
+    self->src = *src;
+    self->delim = delim;
+    self->delim_len = delim_len;
+    self->pos = 0;
+    self->mode = mode;
+    self->skip_empty = skip_empty;
+    self->done = 0;
+
+    memset(self->set, 0, sizeof(self->set));
+    memset(self->nibbles, 0, sizeof(self->nibbles));
+    for (iter = (const unsigned char *) delim; iter != (const unsigned char *) delim + delim_len; ++iter) {
+        __STL_String_set_add(self->set, self->nibbles, *iter);
+    }
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_tokenizer_next(STL_String_tokenizer *self, STL_String_token *token)
+{
+
+    /* VarCheck */
+    if (self == NULL || token == NULL) {
+        return 0;
+    }
+
+    /* Initializing variables */
+    auto size_t end;
+
+    /* Main part */
+    while (!self->done) {
+        if (!self->delim_len) {
+            end = self->src.nchar;
+        } else if (self->mode == STL_String_split_char) {
+            end = STL_String_split_scan_char(self, self->pos);
+        } else if (self->mode == STL_String_split_str) {
+            end = (self->delim_len == 1) ? STL_String_split_scan_char(self, self->pos)
+                                         : STL_String_split_scan_str(self, self->pos);
+        } else {
+            end = STL_String_split_scan_any(self, self->pos);
+        }
+
+        token->pos = self->pos;
+        token->nchar = end - self->pos;
+
+        if (end == self->src.nchar) {
+            self->done = 1;
+        } else {
+            self->pos = end + ((self->mode == STL_String_split_str) ? self->delim_len : 1);
+        }
+
+        if (token->nchar || !self->skip_empty) {
+            return 1;
+        }
+    }
+
+    /* Returning value */
+    return 0;
+}
+
+STL_String_view STL_String_tokenizer_view(const STL_String_tokenizer *self, const STL_String_token *token)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view = { NULL, 0 };
+
+    /* Main part */
+    if (self != NULL && token != NULL && token->pos + token->nchar <= self->src.nchar) {
+        view.data = self->src.data + token->pos;
+        view.nchar = token->nchar;
+    }
+
+    /* Returning value */
+    return view;
+}
+
+int STL_String_split(const STL_String_view *src, const char *delim, size_t delim_len, int mode, int skip_empty,
+                     STL_Vector *tokens)
+{
+
+    /* VarCheck */
+    if (tokens == NULL) {
+        return STL_String_null_reference_error;
+    }
+    if (tokens->nbytes != sizeof(STL_String_token)) {
+        return STL_String_index_error;
+    }
+
+    /* Initializing variables */
+    auto STL_String_tokenizer tokenizer;
+    auto STL_String_token token;
+    auto int code = STL_String_tokenizer_init(&tokenizer, src, delim, delim_len, mode, skip_empty);
+
+    /* Main part */
+    if (code != STL_String_OK) {
+        return code;
+    }
+
+    while (STL_String_tokenizer_next(&tokenizer, &token)) {
+        if (STL_Vector_push_back(tokens, &token) != STL_Vector_OK) {
+            return STL_String_memory_error;
+        }
+    }
+
+    /* Returning value */
+    return STL_String_OK;
+}
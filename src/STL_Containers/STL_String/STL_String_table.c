@@ -0,0 +1,588 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String_table.h"
+#include "STL_String_internal.h"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifndef min
+#define min(x, y) ((x) < (y) ? (x) : (y))
+#endif
+
+static const size_t thresh = 16;
+static const size_t npos = -1;
+
+/* Runs of this many entries are insertion-sorted before merging */
+static const size_t sort_run = 32;
+
+/* Staging buffer for saving a table whose strings are out of order */
+static const size_t io_bufsize = 64 * 1024;
+
+static const char magic[8] = {'S', 'T', 'L', 'S', 'T', 'A', 'B', '1'};
+
+/* Magic, number of strings and number of characters */
+static const size_t header_size = 24;
+
+static uint32_t STL_String_table_prefix(const char *str, size_t count)
+{
+
+    /* Initializing variables */
+    auto uint32_t prefix = 0;
+    auto size_t i;
+
+    /* Main part */
+    for (i = 0; i < 4; ++i) {
+        prefix = (prefix << 8) | ((i < count) ? (unsigned char) str[i] : 0);
+    }
+
+    /* Returning value */
+    return prefix;
+}
+
+static int STL_String_table_cmp_n(const char *a, size_t a_count, uint32_t a_prefix, const char *b, size_t b_count,
+                                  uint32_t b_prefix)
+{
+
+    /* Initializing variables */
+    auto size_t n, k;
+    auto int r;
+
+    /* Main part */
+    if (a_prefix != b_prefix) {
+        return (a_prefix < b_prefix) ? -1 : 1;
+    }
+
+    /* Equal prefixes mean the first min(n, 4) characters are equal too */
+    n = min(a_count, b_count);
+    k = min(n, 4);
+    if ((r = memcmp(a + k, b + k, n - k)) != 0) {
+        return r;
+    }
+
+    /* Returning value */
+    return (a_count > b_count) - (a_count < b_count);
+}
+
+static int STL_String_table_cmp(const char *chars, const STL_String_table_entry *a, const STL_String_table_entry *b)
+{
+
+    /* Returning value */
+    return STL_String_table_cmp_n(chars + a->offset, a->nchar, a->prefix, chars + b->offset, b->nchar, b->prefix);
+}
+
+static void STL_String_table_le_store(unsigned char *dest, uint64_t value, size_t nbytes)
+{
+
+    /* Initializing variables */
+    auto size_t i;
+
+    /* Main part */
+    for (i = 0; i < nbytes; ++i, value >>= 8) {
+        dest[i] = (unsigned char) value;
+    }
+}
+
+static uint64_t STL_String_table_le_load(const unsigned char *src, size_t nbytes)
+{
+
+    /* Initializing variables */
+    auto uint64_t value = 0;
+
+    /* Main part */
+    while (nbytes--) {
+        value = (value << 8) | src[nbytes];
+    }
+
+    /* Returning value */
+    return value;
+}
+
+static int STL_String_table_write(int fd, const void *buf, size_t count)
+{
+
+    /* Initializing variables */
+    auto ssize_t n;
+
+    /* Main part */
+    while (count) {
+        if ((n = write(fd, buf, count)) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return STL_String_io_error;
+        }
+        buf = (const char *) buf + n;
+        count -= n;
+    }
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+static int STL_String_table_read(int fd, void *buf, size_t count)
+{
+
+    /* Initializing variables */
+    auto ssize_t n;
+
+    /* Main part */
+    while (count) {
+        if ((n = read(fd, buf, count)) <= 0) {
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            return STL_String_io_error;
+        }
+        buf = (char *) buf + n;
+        count -= n;
+    }
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_table_init(STL_String_table *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    self->chars = malloc(thresh);
+    self->entries = malloc(thresh * sizeof(STL_String_table_entry));
+    if (self->chars == NULL || self->entries == NULL) {
+        free(self->chars);
+        free(self->entries);
+        return STL_String_memory_error;
+    }
+
+    self->nchars = self->nentries = 0;
+    self->max_nchars = self->max_nentries = thresh;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+void STL_String_table_delete(STL_String_table *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
+
+    /* Main part */
+    free(self->chars);
+    free(self->entries);
+    self->chars = NULL;
+    self->entries = NULL;
+    self->nchars = self->nentries = self->max_nchars = self->max_nentries = 0;
+}
+
+STL_String_view STL_String_table_at(const STL_String_table *self, size_t index)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+    view.data = NULL;
+    view.nchar = 0;
+
+    /* VarCheck */
+    if (self == NULL || index >= self->nentries) {
+        return view;
+    }
+
+    /* Main part */
+    view.data = self->chars + self->entries[index].offset;
+    view.nchar = self->entries[index].nchar;
+
+    /* Returning value */
+    return view;
+}
+
+size_t STL_String_table_size(const STL_String_table *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return -1;
+    }
+
+    /* Returning value */
+    return self->nentries;
+}
+
+size_t STL_String_table_nchars(const STL_String_table *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return -1;
+    }
+
+    /* Returning value */
+    return self->nchars;
+}
+
+int STL_String_table_reserve(STL_String_table *self, size_t nentries, size_t nchars)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto void *tmp;
+
+    /* Main part */
+    if (nchars > self->max_nchars) {
+        if ((tmp = realloc(self->chars, nchars)) == NULL) {
+            return STL_String_memory_error;
+        }
+        self->chars = tmp;
+        self->max_nchars = nchars;
+    }
+
+    if (nentries > self->max_nentries) {
+        if (nentries > (size_t) -1 / sizeof(STL_String_table_entry) ||
+            (tmp = realloc(self->entries, nentries * sizeof(STL_String_table_entry))) == NULL) {
+            return STL_String_memory_error;
+        }
+        self->entries = tmp;
+        self->max_nentries = nentries;
+    }
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+void STL_String_table_clear(STL_String_table *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
+
+    /* Main part */
+    self->nchars = self->nentries = 0;
+}
+
+int STL_String_table_push_back(STL_String_table *self, const char *str, size_t count)
+{
+
+    /* VarCheck */
+    if (self == NULL || (str == NULL && count)) {
+        return STL_String_null_reference_error;
+    }
+
+    if (count > UINT32_MAX) {
+        return STL_String_index_error;
+    }
+
+    /* Initializing variables */
+    auto STL_String_table_entry *entry;
+    auto size_t new_nchars = self->max_nchars, new_nentries = self->max_nentries, inside = npos;
+
+    /* Main part */
+    /* "str" may be a string of this table, and "chars" is about to move */
+    if (str >= self->chars && str < self->chars + self->nchars) {
+        inside = str - self->chars;
+    }
+
+    while (self->nchars + count > new_nchars) {
+        new_nchars *= 2;
+    }
+    if (self->nentries == new_nentries) {
+        new_nentries *= 2;
+    }
+
+    if (STL_String_table_reserve(self, new_nentries, new_nchars) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    if (inside != npos) {
+        str = self->chars + inside;
+    }
+
+    entry = self->entries + self->nentries++;
+    entry->offset = self->nchars;
+    entry->nchar = (uint32_t) count;
+    entry->prefix = STL_String_table_prefix(str, count);
+
+    memcpy(self->chars + self->nchars, str, count);
+    self->nchars += count;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_table_push_back_view(STL_String_table *self, const STL_String_view *view)
+{
+
+    /* VarCheck */
+    if (view == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_table_push_back(self, view->data, view->nchar);
+}
+
+int STL_String_table_sort(STL_String_table *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto STL_String_table_entry *src = self->entries, *dest, *tmp, key;
+    auto size_t n = self->nentries, width, lo, mid, hi, i, j, k;
+
+    /* Main part */
+    if (n < 2) {
+        return STL_String_OK;
+    }
+
+    for (lo = 0; lo < n; lo += sort_run) {
+        hi = min(lo + sort_run, n);
+        for (i = lo + 1; i < hi; ++i) {
+            key = src[i];
+            for (j = i; j > lo && STL_String_table_cmp(self->chars, &key, &src[j - 1]) < 0; --j) {
+                src[j] = src[j - 1];
+            }
+            src[j] = key;
+        }
+    }
+
+    if (n <= sort_run) {
+        return STL_String_OK;
+    }
+
+    if ((dest = malloc(n * sizeof(STL_String_table_entry))) == NULL) {
+        return STL_String_memory_error;
+    }
+
+    /* Bottom-up merging, ping-ponging between the entries and a scratch array */
+    for (width = sort_run; width < n; width *= 2) {
+        for (lo = 0; lo < n; lo += 2 * width) {
+            mid = min(lo + width, n);
+            hi = min(lo + 2 * width, n);
+            for (i = lo, j = mid, k = lo; i < mid && j < hi;) {
+                dest[k++] = (STL_String_table_cmp(self->chars, &src[j], &src[i]) < 0) ? src[j++] : src[i++];
+            }
+            memcpy(dest + k, src + i, (mid - i) * sizeof(STL_String_table_entry));
+            memcpy(dest + k + mid - i, src + j, (hi - j) * sizeof(STL_String_table_entry));
+        }
+        tmp = src;
+        src = dest;
+        dest = tmp;
+    }
+
+    if (src != self->entries) {
+        memcpy(self->entries, src, n * sizeof(STL_String_table_entry));
+        free(src);
+    } else {
+        free(dest);
+    }
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+size_t STL_String_table_lower_bound(const STL_String_table *self, const char *str, size_t count)
+{
+
+    /* VarCheck */
+    if (self == NULL || (str == NULL && count)) {
+        return npos;
+    }
+
+    /* Initializing variables */
+    auto STL_String_table_entry *entry;
+    auto uint32_t prefix = STL_String_table_prefix(str, count);
+    auto size_t lo = 0, hi = self->nentries, mid;
+
+    /* Main part */
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        entry = self->entries + mid;
+        if (STL_String_table_cmp_n(self->chars + entry->offset, entry->nchar, entry->prefix, str, count, prefix) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    /* Returning value */
+    return lo;
+}
+
+int STL_String_table_save(const STL_String_table *self, int fd)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto unsigned char *buf;
+    auto const STL_String_table_entry *entry;
+    auto size_t used = header_size, i, offset = 0, nchar;
+    auto int code = STL_String_OK, in_order = 1;
+
+    /* Main part */
+    if ((buf = malloc(io_bufsize)) == NULL) {
+        return STL_String_memory_error;
+    }
+
+    memcpy(buf, magic, sizeof(magic));
+    STL_String_table_le_store(buf + 8, self->nentries, 8);
+    STL_String_table_le_store(buf + 16, self->nchars, 8);
+
+    for (i = 0, entry = self->entries; i < self->nentries && code == STL_String_OK; ++i, ++entry) {
+        if (used + 4 > io_bufsize) {
+            code = STL_String_table_write(fd, buf, used);
+            used = 0;
+        }
+        STL_String_table_le_store(buf + used, entry->nchar, 4);
+        used += 4;
+
+        in_order &= (entry->offset == offset);
+        offset += entry->nchar;
+    }
+
+    /* A table in insertion order goes out in one piece, a sorted one is gathered through the buffer */
+    if (code == STL_String_OK && in_order) {
+        if ((code = STL_String_table_write(fd, buf, used)) == STL_String_OK) {
+            code = STL_String_table_write(fd, self->chars, self->nchars);
+        }
+        used = 0;
+    }
+
+    for (i = 0, entry = self->entries; !in_order && i < self->nentries && code == STL_String_OK; ++i, ++entry) {
+        nchar = entry->nchar;
+        if (used + nchar > io_bufsize) {
+            code = STL_String_table_write(fd, buf, used);
+            used = 0;
+        }
+
+        if (nchar > io_bufsize) {
+            if (code == STL_String_OK) {
+                code = STL_String_table_write(fd, self->chars + entry->offset, nchar);
+            }
+        } else {
+            memcpy(buf + used, self->chars + entry->offset, nchar);
+            used += nchar;
+        }
+    }
+
+    if (code == STL_String_OK && used) {
+        code = STL_String_table_write(fd, buf, used);
+    }
+
+    free(buf);
+
+    /* Returning value */
+    return code;
+}
+
+int STL_String_table_load(STL_String_table *self, int fd)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Initializing variables */
+    auto STL_String_table table;
+    auto unsigned char header[24], *lengths;
+    auto uint64_t nentries, nchars, offset = 0;
+    auto STL_String_table_entry *entry;
+    auto size_t i;
+    auto int code;
+
+    /* Main part */
+    if ((code = STL_String_table_read(fd, header, header_size)) != STL_String_OK) {
+        return code;
+    }
+
+    nentries = STL_String_table_le_load(header + 8, 8);
+    nchars = STL_String_table_le_load(header + 16, 8);
+    if (memcmp(header, magic, sizeof(magic)) || nentries > (size_t) -1 / sizeof(STL_String_table_entry) ||
+        nchars > (size_t) -1) {
+        return STL_String_encoding_error;
+    }
+
+    if (STL_String_table_init(&table) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    if (STL_String_table_reserve(&table, (size_t) nentries, (size_t) nchars) != STL_String_OK) {
+        STL_String_table_delete(&table);
+        return STL_String_memory_error;
+    }
+
+    /* The lengths are read into the tail of the entries. Decoding front to back never overtakes them */
+    lengths = (unsigned char *) (table.entries + nentries) - 4 * nentries;
+    if ((code = STL_String_table_read(fd, lengths, 4 * nentries)) != STL_String_OK) {
+        STL_String_table_delete(&table);
+        return code;
+    }
+
+    for (i = 0, entry = table.entries; i < nentries; ++i, ++entry) {
+        entry->nchar = (uint32_t) STL_String_table_le_load(lengths + 4 * i, 4);
+        entry->offset = offset;
+        offset += entry->nchar;
+    }
+
+    if (offset != nchars) {
+        STL_String_table_delete(&table);
+        return STL_String_encoding_error;
+    }
+
+    if ((code = STL_String_table_read(fd, table.chars, nchars)) != STL_String_OK) {
+        STL_String_table_delete(&table);
+        return code;
+    }
+
+    for (i = 0, entry = table.entries; i < nentries; ++i, ++entry) {
+        entry->prefix = STL_String_table_prefix(table.chars + entry->offset, entry->nchar);
+    }
+
+    table.nentries = nentries;
+    table.nchars = nchars;
+    STL_String_table_delete(self);
+    *self = table;
+
+    /* Returning value */
+    return STL_String_OK;
+}
@@ -0,0 +1,556 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String.h"
+#include "../../STL_Headers/STL/STL_String_view.h"
+#include "STL_String_internal.h"
+
+#include <string.h>
+
+#if defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* Error classes of the SIMD validator (Keiser & Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte") */
+#define TOO_SHORT (1 << 0)
+#define TOO_LONG (1 << 1)
+#define OVERLONG_3 (1 << 2)
+#define TOO_LARGE (1 << 3)
+#define SURROGATE (1 << 4)
+#define OVERLONG_2 (1 << 5)
+#define TOO_LARGE_1000 (1 << 6)
+#define OVERLONG_4 (1 << 6)
+#define TWO_CONTS (1 << 7)
+#define CARRY (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+static size_t STL_String_utf8_decode(const unsigned char *p, size_t n, uint32_t *cp)
+{
+
+    /* Decodes one code point. Returns the number of bytes used, 0 if the sequence is malformed */
+
+    /* Initializing variables */
+    auto unsigned char c = p[0];
+
+    /* Main part */
+    if (c < 0x80) {
+        *cp = c;
+        return 1;
+    } else if (c < 0xC2) {
+        return 0;
+    } else if (c < 0xE0) {
+        if (n < 2 || (p[1] & 0xC0) != 0x80) {
+            return 0;
+        }
+        *cp = ((uint32_t) (c & 0x1F) << 6) | (p[1] & 0x3F);
+        return 2;
+    } else if (c < 0xF0) {
+        if (n < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 ||
+            (c == 0xE0 && p[1] < 0xA0) || (c == 0xED && p[1] > 0x9F)) {
+            return 0;
+        }
+        *cp = ((uint32_t) (c & 0x0F) << 12) | ((uint32_t) (p[1] & 0x3F) << 6) | (p[2] & 0x3F);
+        return 3;
+    } else if (c < 0xF5) {
+        if (n < 4 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80 || (p[3] & 0xC0) != 0x80 ||
+            (c == 0xF0 && p[1] < 0x90) || (c == 0xF4 && p[1] > 0x8F)) {
+            return 0;
+        }
+        *cp = ((uint32_t) (c & 0x07) << 18) | ((uint32_t) (p[1] & 0x3F) << 12) | ((uint32_t) (p[2] & 0x3F) << 6) |
+              (p[3] & 0x3F);
+        return 4;
+    }
+
+    /* Returning value */
+    return 0;
+}
+
+static size_t STL_String_utf8_encode(unsigned char *p, uint32_t cp)
+{
+
+    /* Encodes one valid code point. Returns the number of bytes written */
+
+    /* Main part */
+    if (cp < 0x80) {
+        p[0] = (unsigned char) cp;
+        return 1;
+    } else if (cp < 0x800) {
+        p[0] = (unsigned char) (0xC0 | (cp >> 6));
+        p[1] = (unsigned char) (0x80 | (cp & 0x3F));
+        return 2;
+    } else if (cp < 0x10000) {
+        p[0] = (unsigned char) (0xE0 | (cp >> 12));
+        p[1] = (unsigned char) (0x80 | ((cp >> 6) & 0x3F));
+        p[2] = (unsigned char) (0x80 | (cp & 0x3F));
+        return 3;
+    }
+
+    p[0] = (unsigned char) (0xF0 | (cp >> 18));
+    p[1] = (unsigned char) (0x80 | ((cp >> 12) & 0x3F));
+    p[2] = (unsigned char) (0x80 | ((cp >> 6) & 0x3F));
+    p[3] = (unsigned char) (0x80 | (cp & 0x3F));
+
+    /* Returning value */
+    return 4;
+}
+
+#if defined(__SSSE3__)
+static __m128i STL_String_utf8_check_block(__m128i input, __m128i prev_input)
+{
+
+    /* Initializing variables */
+    auto const __m128i nibble = _mm_set1_epi8(0x0F);
+    auto __m128i prev1 = _mm_alignr_epi8(input, prev_input, 15);
+    auto __m128i prev2 = _mm_alignr_epi8(input, prev_input, 14);
+    auto __m128i prev3 = _mm_alignr_epi8(input, prev_input, 13);
+    auto __m128i byte_1_high, byte_1_low, byte_2_high, special, must23;
+
+    /* Main part */
+    /* Every error shows up in the first two bytes of a sequence, looked up by nibble */
+    byte_1_high = _mm_shuffle_epi8(_mm_setr_epi8(TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                                                 TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                                                 TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+                                                 TOO_SHORT | OVERLONG_2,
+                                                 TOO_SHORT,
+                                                 TOO_SHORT | OVERLONG_3 | SURROGATE,
+                                                 TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4),
+                                   _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+    byte_1_low = _mm_shuffle_epi8(_mm_setr_epi8(CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+                                                CARRY | OVERLONG_2,
+                                                CARRY,
+                                                CARRY,
+                                                CARRY | TOO_LARGE,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                                                CARRY | TOO_LARGE | TOO_LARGE_1000),
+                                  _mm_and_si128(prev1, nibble));
+    byte_2_high = _mm_shuffle_epi8(_mm_setr_epi8(TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                                                 TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                                                 TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+                                                 TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+                                                 TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                                                 TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                                                 TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT),
+                                   _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+    special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    /* The third and fourth bytes of 3- and 4-byte sequences must be continuations too */
+    must23 = _mm_or_si128(_mm_subs_epu8(prev2, _mm_set1_epi8((char) (0xE0 - 0x80))),
+                          _mm_subs_epu8(prev3, _mm_set1_epi8((char) (0xF0 - 0x80))));
+
+    /* Returning value */
+    return _mm_xor_si128(_mm_and_si128(must23, _mm_set1_epi8((char) 0x80)), special);
+}
+#endif
+
+static int STL_String_utf8_is_valid(const unsigned char *p, size_t n)
+{
+
+#if defined(__SSSE3__)
+    /* Initializing variables */
+    auto const __m128i max_array = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                                 (char) (0xF0 - 1), (char) (0xE0 - 1), (char) (0xC0 - 1));
+    auto __m128i error = _mm_setzero_si128(), prev_input = error, prev_incomplete = error, input;
+    auto unsigned char tail[16];
+    auto size_t i;
+
+    /* Main part */
+    for (i = 0; i < n; i += 16) {
+        if (n - i >= 16) {
+            input = _mm_loadu_si128((const __m128i *) (p + i));
+        } else {
+            memset(tail, 0, sizeof(tail));
+            memcpy(tail, p + i, n - i);
+            input = _mm_loadu_si128((const __m128i *) tail);
+        }
+
+        if (!_mm_movemask_epi8(input)) {
+            error = _mm_or_si128(error, prev_incomplete);
+        } else {
+            error = _mm_or_si128(error, STL_String_utf8_check_block(input, prev_input));
+            prev_incomplete = _mm_subs_epu8(input, max_array);
+        }
+        prev_input = input;
+    }
+    error = _mm_or_si128(error, prev_incomplete);
+
+    /* Returning value */
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(error, _mm_setzero_si128())) == 0xFFFF;
+#else
+    /* Initializing variables */
+    auto size_t i = 0, used;
+    auto uint32_t cp;
+
+    /* Main part */
+    while (i < n) {
+#if defined(__SSE2__)
+        while (n - i >= 16 && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i *) (p + i)))) {
+            i += 16;
+        }
+        if (i == n) {
+            break;
+        }
+#endif
+        if ((used = STL_String_utf8_decode(p + i, n - i, &cp)) == 0) {
+            return 0;
+        }
+        i += used;
+    }
+
+    /* Returning value */
+    return 1;
+#endif
+}
+
+static int STL_String_utf_prepare(STL_String *dest, size_t charWidth, size_t nchar)
+{
+
+    /* Reinterprets the buffer of "dest" for "charWidth"-byte units and makes room for "nchar" of them */
+
+    /* Initializing variables */
+    auto size_t nbytes;
+
+    /* Main part */
+    if (__STL_String_prepare_write(dest) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    nbytes = dest->max_nchar * dest->charWidth;
+    dest->charWidth = charWidth;
+    dest->max_nchar = nbytes / charWidth;
+    dest->nchar = 0;
+
+    /* Returning value */
+    return STL_String_reserve(dest, nchar);
+}
+
+static void STL_String_utf_finish(STL_String *dest, size_t nchar)
+{
+
+    /* Main part */
+    dest->nchar = nchar;
+    memset(dest->data + nchar * dest->charWidth, 0, dest->charWidth);
+}
+
+int STL_String_view_utf8_validate(const STL_String_view *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_utf8_is_valid((const unsigned char *) self->data, self->nchar) ? STL_String_OK
+                                                                                      : STL_String_encoding_error;
+}
+
+size_t STL_String_view_utf8_length(const STL_String_view *self)
+{
+
+    /* Initializing variables */
+    auto const unsigned char *p;
+    auto size_t i = 0, count = 0;
+#if defined(__SSE2__)
+    auto __m128i acc;
+    auto size_t rounds;
+#endif
+
+    /* VarCheck */
+    if (self == NULL) {
+        return 0;
+    }
+
+    /* Main part */
+    /* Every byte except a continuation byte (10xxxxxx) starts a code point */
+    p = (const unsigned char *) self->data;
+#if defined(__SSE2__)
+    while (self->nchar - i >= 16) {
+        acc = _mm_setzero_si128();
+        for (rounds = 0; rounds < 255 && self->nchar - i >= 16; ++rounds, i += 16) {
+            acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(_mm_loadu_si128((const __m128i *) (p + i)), _mm_set1_epi8(-65)));
+        }
+        acc = _mm_sad_epu8(acc, _mm_setzero_si128());
+        count += (size_t) _mm_cvtsi128_si32(acc) + (size_t) _mm_cvtsi128_si32(_mm_srli_si128(acc, 8));
+    }
+#endif
+    for ( ; i < self->nchar; ++i) {
+        count += (p[i] & 0xC0) != 0x80;
+    }
+
+    /* Returning value */
+    return count;
+}
+
+int STL_String_utf8_validate(STL_String *self)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    STL_String_view_init_string(&view, self);
+
+    /* Returning value */
+    return STL_String_view_utf8_validate(&view);
+}
+
+size_t STL_String_utf8_length(STL_String *self)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return 0;
+    }
+
+    /* Main part */
+    STL_String_view_init_string(&view, self);
+
+    /* Returning value */
+    return STL_String_view_utf8_length(&view);
+}
+
+int STL_String_utf8_to_utf16(STL_String *dest, const STL_String_view *src)
+{
+
+    /* Initializing variables */
+    auto const unsigned char *p;
+    auto uint16_t *out;
+    auto size_t i = 0, n, used;
+    auto uint32_t cp;
+#if defined(__SSE2__)
+    auto __m128i input;
+#endif
+
+    /* VarCheck */
+    if (dest == NULL || src == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    /* A UTF-16 string never has more units than its UTF-8 form has bytes */
+    if (STL_String_utf_prepare(dest, sizeof(uint16_t), src->nchar) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    p = (const unsigned char *) src->data;
+    out = (uint16_t *) dest->data;
+    for (n = src->nchar; i < n; ) {
+#if defined(__SSE2__)
+        /* ASCII runs are widened 16 bytes at a time */
+        while (n - i >= 16 && !_mm_movemask_epi8(input = _mm_loadu_si128((const __m128i *) (p + i)))) {
+            _mm_storeu_si128((__m128i *) out, _mm_unpacklo_epi8(input, _mm_setzero_si128()));
+            _mm_storeu_si128((__m128i *) (out + 8), _mm_unpackhi_epi8(input, _mm_setzero_si128()));
+            out += 16;
+            i += 16;
+        }
+        if (i == n) {
+            break;
+        }
+#endif
+        if ((used = STL_String_utf8_decode(p + i, n - i, &cp)) == 0) {
+            STL_String_utf_finish(dest, 0);
+            return STL_String_encoding_error;
+        }
+        i += used;
+
+        if (cp < 0x10000) {
+            *out++ = (uint16_t) cp;
+        } else {
+            cp -= 0x10000;
+            *out++ = (uint16_t) (0xD800 | (cp >> 10));
+            *out++ = (uint16_t) (0xDC00 | (cp & 0x3FF));
+        }
+    }
+
+    STL_String_utf_finish(dest, out - (uint16_t *) dest->data);
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_utf8_to_utf32(STL_String *dest, const STL_String_view *src)
+{
+
+    /* Initializing variables */
+    auto const unsigned char *p;
+    auto uint32_t *out, cp;
+    auto size_t i = 0, n, used;
+#if defined(__SSE2__)
+    auto __m128i input, half;
+#endif
+
+    /* VarCheck */
+    if (dest == NULL || src == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    /* Counting first costs a fraction of the decoding and sizes the result exactly */
+    if (STL_String_utf_prepare(dest, sizeof(uint32_t), STL_String_view_utf8_length(src)) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    p = (const unsigned char *) src->data;
+    out = (uint32_t *) dest->data;
+    for (n = src->nchar; i < n; ) {
+#if defined(__SSE2__)
+        while (n - i >= 16 && !_mm_movemask_epi8(input = _mm_loadu_si128((const __m128i *) (p + i)))) {
+            half = _mm_unpacklo_epi8(input, _mm_setzero_si128());
+            _mm_storeu_si128((__m128i *) out, _mm_unpacklo_epi16(half, _mm_setzero_si128()));
+            _mm_storeu_si128((__m128i *) (out + 4), _mm_unpackhi_epi16(half, _mm_setzero_si128()));
+            half = _mm_unpackhi_epi8(input, _mm_setzero_si128());
+            _mm_storeu_si128((__m128i *) (out + 8), _mm_unpacklo_epi16(half, _mm_setzero_si128()));
+            _mm_storeu_si128((__m128i *) (out + 12), _mm_unpackhi_epi16(half, _mm_setzero_si128()));
+            out += 16;
+            i += 16;
+        }
+        if (i == n) {
+            break;
+        }
+#endif
+        if ((used = STL_String_utf8_decode(p + i, n - i, &cp)) == 0) {
+            STL_String_utf_finish(dest, 0);
+            return STL_String_encoding_error;
+        }
+        i += used;
+        *out++ = cp;
+    }
+
+    STL_String_utf_finish(dest, out - (uint32_t *) dest->data);
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_utf16_to_utf8(STL_String *dest, STL_String *src)
+{
+
+    /* Initializing variables */
+    auto const uint16_t *p;
+    auto unsigned char *out;
+    auto size_t i = 0, n;
+    auto uint32_t cp;
+#if defined(__SSE2__)
+    auto __m128i input;
+#endif
+
+    /* VarCheck */
+    if (dest == NULL || src == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    if (src->charWidth != sizeof(uint16_t) || dest == src) {
+        return STL_String_encoding_error;
+    }
+
+    /* Main part */
+    /* Each UTF-16 unit takes at most three UTF-8 bytes */
+    if (STL_String_utf_prepare(dest, 1, src->nchar * 3) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    p = (const uint16_t *) src->data;
+    out = (unsigned char *) dest->data;
+    for (n = src->nchar; i < n; ) {
+#if defined(__SSE2__)
+        /* Eight ASCII units are narrowed at a time */
+        while (n - i >= 8 && _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(
+            input = _mm_loadu_si128((const __m128i *) (p + i)), _mm_set1_epi16((short) 0xFF80)),
+                                                               _mm_setzero_si128())) == 0xFFFF) {
+            _mm_storel_epi64((__m128i *) out, _mm_packus_epi16(input, input));
+            out += 8;
+            i += 8;
+        }
+        if (i == n) {
+            break;
+        }
+#endif
+        cp = p[i++];
+        if (cp >= 0xD800 && cp <= 0xDFFF) {
+            if (cp > 0xDBFF || i == n || p[i] < 0xDC00 || p[i] > 0xDFFF) {
+                STL_String_utf_finish(dest, 0);
+                return STL_String_encoding_error;
+            }
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (p[i++] - 0xDC00);
+        }
+        out += STL_String_utf8_encode(out, cp);
+    }
+
+    STL_String_utf_finish(dest, out - (unsigned char *) dest->data);
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_utf32_to_utf8(STL_String *dest, STL_String *src)
+{
+
+    /* Initializing variables */
+    auto const uint32_t *p;
+    auto unsigned char *out;
+    auto size_t i, n;
+
+    /* VarCheck */
+    if (dest == NULL || src == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    if (src->charWidth != sizeof(uint32_t) || dest == src) {
+        return STL_String_encoding_error;
+    }
+
+    /* Main part */
+    if (STL_String_utf_prepare(dest, 1, src->nchar * 4) != STL_String_OK) {
+        return STL_String_memory_error;
+    }
+
+    p = (const uint32_t *) src->data;
+    out = (unsigned char *) dest->data;
+    for (i = 0, n = src->nchar; i < n; ++i) {
+        if (p[i] > 0x10FFFF || (p[i] >= 0xD800 && p[i] <= 0xDFFF)) {
+            STL_String_utf_finish(dest, 0);
+            return STL_String_encoding_error;
+        }
+        out += STL_String_utf8_encode(out, p[i]);
+    }
+
+    STL_String_utf_finish(dest, out - (unsigned char *) dest->data);
+
+    /* Returning value */
+    return STL_String_OK;
+}
@@ -0,0 +1,493 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_String_view.h"
+
+#include <string.h>
+
+#ifndef min
+#define min(x, y) ((x) < (y) ? (x) : (y))
+#endif
+
+static const size_t npos = -1;
+
+static void STL_String_view_make_set(unsigned char *set, const char *str)
+{
+
+    /* Initializing variables */
+    register const unsigned char *iter;
+
+    /* Main part */
+    memset(set, 0, 32);
+    for (iter = (const unsigned char *) str; *iter != '\0'; ++iter) {
+        set[*iter >> 3] |= (unsigned char) (1u << (*iter & 7));
+    }
+}
+
+static int STL_String_view_in_set(const unsigned char *set, char ch)
+{
+
+    /* Returning value */
+    return (set[(unsigned char) ch >> 3] >> ((unsigned char) ch & 7)) & 1;
+}
+
+int STL_String_view_init(STL_String_view *self, const char *str, size_t count)
+{
+
+    /* VarCheck */
+    if (self == NULL || (str == NULL && count)) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Main part */
+    self->data = str;
+    self->nchar = count;
+
+    /* Returning value */
+    return STL_String_OK;
+}
+
+int STL_String_view_init_str(STL_String_view *self, const char *str)
+{
+
+    /* VarCheck */
+    if (str == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_init(self, str, strlen(str));
+}
+
+int STL_String_view_init_string(STL_String_view *self, STL_String *str)
+{
+
+    /* VarCheck */
+    if (str == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_init(self, (const char *) str->data, str->nchar * str->charWidth);
+}
+
+const char *STL_String_view_at(const STL_String_view *self, size_t pos)
+{
+
+    /* VarCheck */
+    if (self == NULL || pos >= self->nchar) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return self->data + pos;
+}
+
+const char *STL_String_view_front(const STL_String_view *self)
+{
+
+    /* Returning value */
+    return STL_String_view_at(self, 0);
+}
+
+const char *STL_String_view_back(const STL_String_view *self)
+{
+
+    /* VarCheck */
+    if (self == NULL || !self->nchar) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_String_view_at(self, self->nchar - 1);
+}
+
+const char *STL_String_view_data(const STL_String_view *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return self->data;
+}
+
+const char *STL_String_view_begin(const STL_String_view *self)
+{
+
+    /* Returning value */
+    return STL_String_view_data(self);
+}
+
+const char *STL_String_view_end(const STL_String_view *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return self->data + self->nchar;
+}
+
+int STL_String_view_empty(const STL_String_view *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return (!self->nchar) ? string_is_empty : string_not_empty;
+}
+
+size_t STL_String_view_size(const STL_String_view *self)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return -1;
+    }
+
+    /* Returning value */
+    return self->nchar;
+}
+
+size_t STL_String_view_length(const STL_String_view *self)
+{
+
+    /* Returning value */
+    return STL_String_view_size(self);
+}
+
+void STL_String_view_remove_prefix(STL_String_view *self, size_t n)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
+
+    /* Main part */
+    n = min(n, self->nchar);
+    self->data += n;
+    self->nchar -= n;
+}
+
+void STL_String_view_remove_suffix(STL_String_view *self, size_t n)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return;
+    }
+
+    /* Main part */
+    self->nchar -= min(n, self->nchar);
+}
+
+size_t STL_String_view_copy(const STL_String_view *self, char *dest, size_t count, size_t pos)
+{
+
+    /* Initializing variables */
+    auto size_t toCopy;
+
+    /* VarCheck */
+    if (self == NULL || dest == NULL || pos > self->nchar) {
+        return 0;
+    }
+
+    /* Main part */
+    toCopy = min(count, self->nchar - pos);
+    memcpy(dest, self->data + pos, toCopy);
+
+    /* Returning value */
+    return toCopy;
+}
+
+STL_String_view STL_String_view_substr(const STL_String_view *self, size_t pos, size_t count)
+{
+
+    /* Initializing variables */
+    auto STL_String_view view;
+    view.data = NULL;
+    view.nchar = 0;
+
+    /* VarCheck */
+    if (self == NULL || pos > self->nchar) {
+        return view;
+    }
+
+    /* Main part */
+    view.data = self->data + pos;
+    view.nchar = min(count, self->nchar - pos);
+
+    /* Returning value */
+    return view;
+}
+
+int STL_String_view_compare(const STL_String_view *self, const STL_String_view *other)
+{
+
+    /* Initializing variables */
+    auto int res;
+
+    /* Main part */
+    if ((res = memcmp(self->data, other->data, min(self->nchar, other->nchar))) != 0) {
+        return res;
+    }
+
+    /* Returning value */
+    return (self->nchar > other->nchar) ? 1 : (self->nchar < other->nchar) ? -1 : 0;
+}
+
+int STL_String_view_starts_with(const STL_String_view *self, const char *prefix)
+{
+
+    /* VarCheck */
+    if (prefix == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_starts_with_n(self, prefix, strlen(prefix));
+}
+
+int STL_String_view_starts_with_n(const STL_String_view *self, const char *prefix, size_t count)
+{
+
+    /* VarCheck */
+    if (self == NULL || (prefix == NULL && count)) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return count <= self->nchar && !memcmp(self->data, prefix, count);
+}
+
+int STL_String_view_ends_with(const STL_String_view *self, const char *suffix)
+{
+
+    /* VarCheck */
+    if (suffix == NULL) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return STL_String_view_ends_with_n(self, suffix, strlen(suffix));
+}
+
+int STL_String_view_ends_with_n(const STL_String_view *self, const char *suffix, size_t count)
+{
+
+    /* VarCheck */
+    if (self == NULL || (suffix == NULL && count)) {
+        return STL_String_null_reference_error;
+    }
+
+    /* Returning value */
+    return count <= self->nchar && !memcmp(self->data + self->nchar - count, suffix, count);
+}
+
+size_t STL_String_view_find(const STL_String_view *self, const char *str)
+{
+
+    /* VarCheck */
+    if (str == NULL) {
+        return npos;
+    }
+
+    /* Returning value */
+    return STL_String_view_find_n(self, str, strlen(str));
+}
+
+size_t STL_String_view_find_n(const STL_String_view *self, const char *str, size_t count)
+{
+
+    /* Initializing variables */
+    auto const char *iter, *last;
+
+    /* VarCheck */
+    if (self == NULL || (str == NULL && count)) {
+        return npos;
+    }
+
+    /* Main part */
+    if (count == 0) {
+        return 0;
+    } else if (count > self->nchar) {
+        return npos;
+    }
+
+    /* memchr() skips to the candidates, memcmp() confirms them */
+    for (iter = self->data, last = self->data + self->nchar - count;
+         iter <= last && (iter = memchr(iter, *str, last - iter + 1)) != NULL; ++iter) {
+        if (!memcmp(iter + 1, str + 1, count - 1)) {
+            return iter - self->data;
+        }
+    }
+
+    /* Returning value */
+    return npos;
+}
+
+size_t STL_String_view_rfind(const STL_String_view *self, const char *str)
+{
+
+    /* VarCheck */
+    if (str == NULL) {
+        return npos;
+    }
+
+    /* Returning value */
+    return STL_String_view_rfind_n(self, str, strlen(str));
+}
+
+size_t STL_String_view_rfind_n(const STL_String_view *self, const char *str, size_t count)
+{
+
+    /* Initializing variables */
+    register const char *iter;
+
+    /* VarCheck */
+    if (self == NULL || (str == NULL && count)) {
+        return npos;
+    }
+
+    /* Main part */
+    if (count == 0) {
+        return self->nchar;
+    } else if (count > self->nchar) {
+        return npos;
+    }
+
+    for (iter = self->data + self->nchar - count; ; --iter) {
+        if (*iter == *str && !memcmp(iter, str, count)) {
+            return iter - self->data;
+        }
+
+        if (iter == self->data) {
+            break;
+        }
+    }
+
+    /* Returning value */
+    return npos;
+}
+
+size_t STL_String_view_find_first_of(const STL_String_view *self, const char *str)
+{
+
+    /* Initializing variables */
+    register const char *iter;
+    auto unsigned char set[32];
+
+    /* VarCheck */
+    if (self == NULL || str == NULL) {
+        return npos;
+    }
+
+    /* Main part */
+    STL_String_view_make_set(set, str);
+    for (iter = self->data; iter != self->data + self->nchar; ++iter) {
+        if (STL_String_view_in_set(set, *iter)) {
+            return iter - self->data;
+        }
+    }
+
+    /* Returning value */
+    return npos;
+}
+
+size_t STL_String_view_find_first_not_of(const STL_String_view *self, const char *str)
+{
+
+    /* Initializing variables */
+    register const char *iter;
+    auto unsigned char set[32];
+
+    /* VarCheck */
+    if (self == NULL || str == NULL) {
+        return npos;
+    }
+
+    /* Main part */
+    STL_String_view_make_set(set, str);
+    for (iter = self->data; iter != self->data + self->nchar; ++iter) {
+        if (!STL_String_view_in_set(set, *iter)) {
+            return iter - self->data;
+        }
+    }
+
+    /* Returning value */
+    return npos;
+}
+
+size_t STL_String_view_find_last_of(const STL_String_view *self, const char *str)
+{
+
+    /* Initializing variables */
+    register const char *iter;
+    auto unsigned char set[32];
+
+    /* VarCheck */
+    if (self == NULL || str == NULL) {
+        return npos;
+    }
+
+    /* Main part */
+    STL_String_view_make_set(set, str);
+    for (iter = self->data + self->nchar; iter != self->data; --iter) {
+        if (STL_String_view_in_set(set, *(iter - 1))) {
+            return iter - 1 - self->data;
+        }
+    }
+
+    /* Returning value */
+    return npos;
+}
+
+size_t STL_String_view_find_last_not_of(const STL_String_view *self, const char *str)
+{
+
+    /* Initializing variables */
+    register const char *iter;
+    auto unsigned char set[32];
+
+    /* VarCheck */
+    if (self == NULL || str == NULL) {
+        return npos;
+    }
+
+    /* Main part */
+    STL_String_view_make_set(set, str);
+    for (iter = self->data + self->nchar; iter != self->data; --iter) {
+        if (!STL_String_view_in_set(set, *(iter - 1))) {
+            return iter - 1 - self->data;
+        }
+    }
+
+    /* Returning value */
+    return npos;
+}
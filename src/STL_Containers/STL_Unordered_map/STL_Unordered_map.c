@@ -20,6 +20,7 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 
 /* Header inclusion */
 #include "../../STL_Headers/STL/STL_Unordered_map.h"
+#include "../../STL_Headers/STL/STL_String_view.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -29,17 +30,13 @@ static STL_Unordered_map_key_t default_hash_f(void *elem, size_t total_elem)
 {
 
     /* Initializing variables */
-    auto char *str = (char *) elem;
-    auto unsigned long hash = 5381u;
-    auto int c;
+    auto STL_String_view key;
 
     /* Main part */
-    while ((c = *str++)) {
-        hash = ((hash << 5) + hash) + c;
-    }
+    STL_String_view_init_str(&key, (const char *) elem);
 
     /* Returning value */
-    return hash % total_elem;
+    return STL_String_view_hash(&key, 0) % total_elem;
 }
 
 int STL_Unordered_map_init(STL_Unordered_map *self, size_t elem_size, STL_Unordered_map_hash_function_t func)
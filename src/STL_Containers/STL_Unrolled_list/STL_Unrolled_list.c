@@ -0,0 +1,549 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include "../../STL_Headers/STL/STL_Unrolled_list.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Elements are stored right after the node, 16-byte aligned */
+static const size_t node_header = (sizeof(STL_Unrolled_list_node) + 15) & ~(size_t) 15;
+
+/* Default nodes hold about this many bytes of elements, but no less than "min_capacity" elements */
+static const size_t default_node_bytes = 1024;
+static const size_t min_capacity = 8;
+
+static char *STL_Unrolled_list_elem(const STL_Unrolled_list *self, STL_Unrolled_list_node *node, size_t i)
+{
+
+    /* Returning value */
+    return (char *) node + node_header + i * self->nbytes;
+}
+
+static STL_Unrolled_list_node *STL_Unrolled_list_new_node(STL_Unrolled_list *self, STL_Unrolled_list_node *after)
+{
+
+    /* Links an empty node after "after", or first if "after" is NULL */
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_node *node;
+
+    /* Main part */
+    if ((node = malloc(node_header + self->node_capacity * self->nbytes)) == NULL) {
+        return NULL;
+    }
+
+    node->nelem = 0;
+    node->prev = after;
+    node->next = (after != NULL) ? after->next : self->head;
+
+    if (node->next != NULL) {
+        node->next->prev = node;
+    } else {
+        self->tail = node;
+    }
+    if (after != NULL) {
+        after->next = node;
+    } else {
+        self->head = node;
+    }
+
+    /* Returning value */
+    return node;
+}
+
+static void STL_Unrolled_list_free_node(STL_Unrolled_list *self, STL_Unrolled_list_node *node)
+{
+
+    /* Main part */
+    if (node->prev != NULL) {
+        node->prev->next = node->next;
+    } else {
+        self->head = node->next;
+    }
+    if (node->next != NULL) {
+        node->next->prev = node->prev;
+    } else {
+        self->tail = node->prev;
+    }
+
+    free(node);
+}
+
+int STL_Unrolled_list_init(STL_Unrolled_list *self, size_t nbytes, size_t node_capacity)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_Unrolled_list_null_reference_error;
+    }
+
+    if (!nbytes || (node_capacity && node_capacity > ((size_t) -1 - node_header) / nbytes)) {
+        return STL_Unrolled_list_index_error;
+    }
+
+    /* Main part */
+    if (!node_capacity) {
+        node_capacity = default_node_bytes / nbytes;
+        node_capacity = (node_capacity > min_capacity) ? node_capacity : min_capacity;
+    }
+
+    self->head = self->tail = NULL;
+    self->nbytes = nbytes;
+    self->nelem = 0;
+
+    /* Splitting a full node has to leave something on both sides */
+    self->node_capacity = (node_capacity > 1) ? node_capacity : 2;
+
+    /* Returning value */
+    return STL_Unrolled_list_OK;
+}
+
+int STL_Unrolled_list_init_cpy(STL_Unrolled_list *self, STL_Unrolled_list *other)
+{
+
+    /* Initializing variables */
+    register STL_Unrolled_list_node *iter;
+    auto STL_Unrolled_list_node *node;
+    auto int code;
+
+    /* VarCheck */
+    if (self == NULL || other == NULL) {
+        return STL_Unrolled_list_null_reference_error;
+    }
+
+    /* Main part */
+    if ((code = STL_Unrolled_list_init(self, other->nbytes, other->node_capacity)) != STL_Unrolled_list_OK) {
+        return code;
+    }
+
+    /* Nodes are copied whole, so the copy is laid out just like the original */
+    for (iter = other->head; iter != NULL; iter = iter->next) {
+        if ((node = STL_Unrolled_list_new_node(self, self->tail)) == NULL) {
+            STL_Unrolled_list_delete(self);
+            return STL_Unrolled_list_memory_error;
+        }
+
+        memcpy(STL_Unrolled_list_elem(self, node, 0), STL_Unrolled_list_elem(other, iter, 0),
+               iter->nelem * other->nbytes);
+        node->nelem = iter->nelem;
+        self->nelem += iter->nelem;
+    }
+
+    /* Returning value */
+    return STL_Unrolled_list_OK;
+}
+
+void STL_Unrolled_list_delete(STL_Unrolled_list *self)
+{
+
+    /* Main part */
+    STL_Unrolled_list_clear(self);
+}
+
+void *STL_Unrolled_list_at(STL_Unrolled_list *self, size_t pos)
+{
+
+    /* VarCheck */
+    if (self == NULL) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_Unrolled_list_get(self, STL_Unrolled_list_iterator_at(self, pos));
+}
+
+void *STL_Unrolled_list_front(STL_Unrolled_list *self)
+{
+
+    /* VarCheck */
+    if (self == NULL || self->head == NULL) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_Unrolled_list_elem(self, self->head, 0);
+}
+
+void *STL_Unrolled_list_back(STL_Unrolled_list *self)
+{
+
+    /* VarCheck */
+    if (self == NULL || self->tail == NULL) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_Unrolled_list_elem(self, self->tail, self->tail->nelem - 1);
+}
+
+void *STL_Unrolled_list_node_data(const STL_Unrolled_list_node *node)
+{
+
+    /* Returning value */
+    return (char *) node + node_header;
+}
+
+STL_Unrolled_list_iterator STL_Unrolled_list_begin(STL_Unrolled_list *self)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_iterator iter;
+
+    /* Main part */
+    iter.node = self->head;
+    iter.index = 0;
+
+    /* Returning value */
+    return iter;
+}
+
+STL_Unrolled_list_iterator STL_Unrolled_list_end(STL_Unrolled_list *self)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_iterator iter;
+
+    /* Main part */
+    (void) self;
+    iter.node = NULL;
+    iter.index = 0;
+
+    /* Returning value */
+    return iter;
+}
+
+STL_Unrolled_list_iterator STL_Unrolled_list_iterator_at(STL_Unrolled_list *self, size_t pos)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_iterator iter;
+    register size_t first;
+
+    /* Main part */
+    iter = STL_Unrolled_list_end(self);
+    if (pos >= self->nelem) {
+        return iter;
+    }
+
+    /* Whole nodes are skipped, from whichever end is closer */
+    if (pos < self->nelem / 2) {
+        for (iter.node = self->head, first = 0; first + iter.node->nelem <= pos; iter.node = iter.node->next) {
+            first += iter.node->nelem;
+        }
+    } else {
+        for (iter.node = self->tail, first = self->nelem - iter.node->nelem; first > pos;
+             iter.node = iter.node->prev, first -= iter.node->nelem)
+            ;
+    }
+    iter.index = pos - first;
+
+    /* Returning value */
+    return iter;
+}
+
+void *STL_Unrolled_list_get(STL_Unrolled_list *self, STL_Unrolled_list_iterator iter)
+{
+
+    /* VarCheck */
+    if (self == NULL || iter.node == NULL || iter.index >= iter.node->nelem) {
+        return NULL;
+    }
+
+    /* Returning value */
+    return STL_Unrolled_list_elem(self, iter.node, iter.index);
+}
+
+void STL_Unrolled_list_next(STL_Unrolled_list_iterator *iter)
+{
+
+    /* Main part */
+    if (iter->node != NULL && ++iter->index >= iter->node->nelem) {
+        iter->node = iter->node->next;
+        iter->index = 0;
+    }
+}
+
+void STL_Unrolled_list_prev(STL_Unrolled_list *self, STL_Unrolled_list_iterator *iter)
+{
+
+    /* Main part */
+    if (iter->node == NULL) {
+        if (self->tail != NULL) {
+            iter->node = self->tail;
+            iter->index = self->tail->nelem - 1;
+        }
+    } else if (iter->index > 0) {
+        --iter->index;
+    } else if (iter->node->prev != NULL) {
+        iter->node = iter->node->prev;
+        iter->index = iter->node->nelem - 1;
+    }
+}
+
+int STL_Unrolled_list_empty(STL_Unrolled_list *self)
+{
+
+    /* Returning value */
+    return (self->nelem) ? unrolled_list_not_empty : unrolled_list_is_empty;
+}
+
+size_t STL_Unrolled_list_size(STL_Unrolled_list *self)
+{
+
+    /* Main part */
+    if (self == NULL) {
+        return 0;
+    }
+
+    /* Returning value */
+    return self->nelem;
+}
+
+void STL_Unrolled_list_clear(STL_Unrolled_list *self)
+{
+
+    /* Initializing variables */
+    register STL_Unrolled_list_node *iter, *next;
+
+    /* Main part */
+    if (self == NULL) {
+        return;
+    }
+
+    for (iter = self->head; iter != NULL; iter = next) {
+        next = iter->next;
+        free(iter);
+    }
+
+    self->head = self->tail = NULL;
+    self->nelem = 0;
+}
+
+int STL_Unrolled_list_insert(STL_Unrolled_list *self, STL_Unrolled_list_iterator *pos, const void *elem)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_node *node, *next;
+    auto size_t i, half;
+
+    /* VarCheck */
+    if (self == NULL || pos == NULL || elem == NULL) {
+        return STL_Unrolled_list_null_reference_error;
+    }
+
+    node = pos->node;
+    i = pos->index;
+    if (node != NULL && i > node->nelem) {
+        return STL_Unrolled_list_index_error;
+    }
+
+    /* Main part */
+    if (node == NULL) {
+        /* Appending never splits: a full last node just gets a new one after it */
+        node = self->tail;
+        i = (node != NULL) ? node->nelem : 0;
+        if (node == NULL || node->nelem == self->node_capacity) {
+            if ((node = STL_Unrolled_list_new_node(self, self->tail)) == NULL) {
+                return STL_Unrolled_list_memory_error;
+            }
+            i = 0;
+        }
+    } else if (node->nelem == self->node_capacity) {
+        if (i == 0 && node->prev != NULL && node->prev->nelem < self->node_capacity) {
+            node = node->prev;
+            i = node->nelem;
+        } else {
+            /* The upper half of a full node moves to a new one, so both stay at least half full */
+            if ((next = STL_Unrolled_list_new_node(self, node)) == NULL) {
+                return STL_Unrolled_list_memory_error;
+            }
+
+            half = self->node_capacity / 2;
+            next->nelem = node->nelem - half;
+            memcpy(STL_Unrolled_list_elem(self, next, 0), STL_Unrolled_list_elem(self, node, half),
+                   next->nelem * self->nbytes);
+            node->nelem = half;
+
+            if (i > half) {
+                node = next;
+                i -= half;
+            }
+        }
+    }
+
+    memmove(STL_Unrolled_list_elem(self, node, i + 1), STL_Unrolled_list_elem(self, node, i),
+            (node->nelem - i) * self->nbytes);
+    memcpy(STL_Unrolled_list_elem(self, node, i), elem, self->nbytes);
+    ++node->nelem;
+    ++self->nelem;
+
+    pos->node = node;
+    pos->index = i;
+
+    /* Returning value */
+    return STL_Unrolled_list_OK;
+}
+
+int STL_Unrolled_list_erase(STL_Unrolled_list *self, STL_Unrolled_list_iterator *pos)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_node *node, *other;
+    auto size_t i, n;
+
+    /* VarCheck */
+    if (self == NULL || pos == NULL) {
+        return STL_Unrolled_list_null_reference_error;
+    }
+
+    node = pos->node;
+    i = pos->index;
+    if (node == NULL || i >= node->nelem) {
+        return STL_Unrolled_list_index_error;
+    }
+
+    /* Main part */
+    memmove(STL_Unrolled_list_elem(self, node, i), STL_Unrolled_list_elem(self, node, i + 1),
+            (node->nelem - i - 1) * self->nbytes);
+    --node->nelem;
+    --self->nelem;
+
+    /* A node less than half full takes elements from the next one, or all of them if they fit */
+    if (node->nelem < self->node_capacity / 2 && (other = node->next) != NULL) {
+        if (node->nelem + other->nelem <= self->node_capacity) {
+            n = other->nelem;
+        } else {
+            n = (other->nelem - node->nelem) / 2;
+        }
+
+        memcpy(STL_Unrolled_list_elem(self, node, node->nelem), STL_Unrolled_list_elem(self, other, 0),
+               n * self->nbytes);
+        node->nelem += n;
+        other->nelem -= n;
+
+        if (other->nelem) {
+            memmove(STL_Unrolled_list_elem(self, other, 0), STL_Unrolled_list_elem(self, other, n),
+                    other->nelem * self->nbytes);
+        } else {
+            STL_Unrolled_list_free_node(self, other);
+        }
+    } else if (node->nelem < self->node_capacity / 2 && (other = node->prev) != NULL &&
+               node->nelem + other->nelem <= self->node_capacity) {
+        /* The last node may stay less than half full, unless it fits into the one before it */
+        memcpy(STL_Unrolled_list_elem(self, other, other->nelem), STL_Unrolled_list_elem(self, node, 0),
+               node->nelem * self->nbytes);
+        i += other->nelem;
+        other->nelem += node->nelem;
+
+        STL_Unrolled_list_free_node(self, node);
+        node = other;
+    } else if (!node->nelem) {
+        STL_Unrolled_list_free_node(self, node);
+        node = NULL;
+    }
+
+    if (node != NULL && i == node->nelem) {
+        node = node->next;
+        i = 0;
+    }
+
+    pos->node = node;
+    pos->index = (node != NULL) ? i : 0;
+
+    /* Returning value */
+    return STL_Unrolled_list_OK;
+}
+
+int STL_Unrolled_list_push_back(STL_Unrolled_list *self, const void *elem)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_iterator iter;
+
+    /* Main part */
+    iter = STL_Unrolled_list_end(self);
+
+    /* Returning value */
+    return STL_Unrolled_list_insert(self, &iter, elem);
+}
+
+void STL_Unrolled_list_pop_back(STL_Unrolled_list *self)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_iterator iter;
+
+    /* VarCheck */
+    if (self == NULL || self->tail == NULL) {
+        return;
+    }
+
+    /* Main part */
+    iter.node = self->tail;
+    iter.index = self->tail->nelem - 1;
+    STL_Unrolled_list_erase(self, &iter);
+}
+
+int STL_Unrolled_list_push_front(STL_Unrolled_list *self, const void *elem)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_iterator iter;
+
+    /* VarCheck */
+    if (self == NULL) {
+        return STL_Unrolled_list_null_reference_error;
+    }
+
+    /* Main part */
+    iter = STL_Unrolled_list_begin(self);
+
+    /* Returning value */
+    return STL_Unrolled_list_insert(self, &iter, elem);
+}
+
+void STL_Unrolled_list_pop_front(STL_Unrolled_list *self)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_iterator iter;
+
+    /* VarCheck */
+    if (self == NULL || self->head == NULL) {
+        return;
+    }
+
+    /* Main part */
+    iter = STL_Unrolled_list_begin(self);
+    STL_Unrolled_list_erase(self, &iter);
+}
+
+void STL_Unrolled_list_swap(STL_Unrolled_list *self, STL_Unrolled_list *other)
+{
+
+    /* Initializing variables */
+    auto STL_Unrolled_list tmp;
+
+    /* Main part */
+    tmp = *other;
+    *other = *self;
+    *self = tmp;
+}
@@ -355,7 +355,7 @@ int STL_Vector_push_back(STL_Vector *self, const void *elem)
     memcpy(self->data + self->nbytes * (self->nelem - 1), elem, self->nbytes);*/
 
     /* Returning value */
-    return (int) STL_Vector_insert(self, elem, STL_Vector_end(self));
+    return (STL_Vector_insert(self, elem, STL_Vector_end(self)) != NULL) ? STL_Vector_OK : STL_Vector_memory_error;
 }
 
 void STL_Vector_pop_back(STL_Vector *self)
@@ -28,6 +28,11 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 /* Sequence containers implement data structures which can be accessed sequentially */
 #include "STL/STL_List.h" /* doubly-linked list */
 #include "STL/STL_Forward_list.h" /* singly-linked list */
+#include "STL/STL_Intrusive_list.h" /* doubly-linked list of links embedded in the elements */
+#include "STL/STL_Intrusive_forward_list.h" /* singly-linked list of links embedded in the elements */
+#include "STL/STL_Unrolled_list.h" /* doubly-linked list of small arrays of elements */
+#include "STL/STL_Index_list.h" /* doubly-linked list in one array, linked by 32-bit indices */
+#include "STL/STL_Concurrent_forward_list.h" /* lock-free sorted singly-linked list of unique elements */
 
 /* Container adaptors provide a different interface for sequential containers */
 #include "STL/STL_Stack.h" /* adapts a container to provide stack (LIFO data structure) */
@@ -36,6 +41,12 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 /* Random-access containers */
 #include "STL/STL_Vector.h" /* wrap for dynamic array */
 #include "STL/STL_String.h" /* wrap for C-styled strings */
+#include "STL/STL_String_view.h" /* non-owning view of a character sequence */
+#include "STL/STL_String_split.h" /* zero-copy tokenizer over string views */
+#include "STL/STL_String_reader.h" /* buffered line reader over a file descriptor */
+#include "STL/STL_String_matcher.h" /* multi-pattern search automaton */
+#include "STL/STL_String_table.h" /* many short strings packed into one buffer */
+#include "STL/STL_String_map.h" /* read-only views of memory-mapped files */
 
 /* Headers that provide access to STL algorithms */
 #include "STL/STL_Algorithm.h"
@@ -0,0 +1,95 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_CONCURRENT_FORWARD_LIST_H
+#define SRC_STL_CONCURRENT_FORWARD_LIST_H
+
+#include <stddef.h>
+
+/* Definition of STL_Concurrent_forward_list_node. The element follows, 16-byte aligned */
+typedef struct __STL_Concurrent_forward_list_node {
+    struct __STL_Concurrent_forward_list_node *next;    /* Lowest bit is set once the node is being erased */
+    struct __STL_Concurrent_forward_list_node *retired; /* Next node waiting to be freed by the same thread */
+} STL_Concurrent_forward_list_node;
+
+/* Definition of STL_Concurrent_forward_list_thread: hazard pointers of one thread and the nodes it has unlinked */
+typedef struct __STL_Concurrent_forward_list_thread {
+    STL_Concurrent_forward_list_node *hazards[2]; /* Nodes this thread is looking at, never freed until cleared */
+    STL_Concurrent_forward_list_node *retired;
+    size_t nretired;
+
+    int active;                                       /* Owned by some thread */
+    struct __STL_Concurrent_forward_list_thread *next; /* Records are reused, and only freed with the list */
+} STL_Concurrent_forward_list_thread;
+
+/* Definition of STL_Concurrent_forward_list: a sorted singly-linked list of unique elements of one size */
+typedef struct __STL_Concurrent_forward_list {
+    STL_Concurrent_forward_list_node *head;
+    STL_Concurrent_forward_list_thread *threads;
+
+    size_t nbytes;
+    size_t nelem;
+    size_t nthreads;
+    int (*cmp)(const void *, const void *);
+} STL_Concurrent_forward_list;
+
+/* STL_Concurrent_forward_list errors */
+enum STL_Concurrent_forward_list_errors {
+    STL_Concurrent_forward_list_OK = 1,                /* Everything is OK. Not an error */
+    STL_Concurrent_forward_list_memory_error,          /* If STL_Concurrent_forward_list routine can't allocate memory */
+    STL_Concurrent_forward_list_index_error,           /* If desired position is wrong */
+    STL_Concurrent_forward_list_null_reference_error,  /* If (STL_Concurrent_forward_list *) or (const void *elem) is NULL */
+    STL_Concurrent_forward_list_key_error              /* If the element is already there on insertion, or missing on erasure */
+};
+
+/* STL_Concurrent_forward_list states */
+enum STL_Concurrent_forward_list_states {
+    concurrent_forward_list_not_empty = 0,
+    concurrent_forward_list_is_empty
+};
+
+/* STL_Concurrent_forward_list methods */
+/* Lock-free: every thread passes its own record from attach(). Nodes are freed once no hazard pointer holds them */
+/* Construction and destruction. Not thread-safe */
+int STL_Concurrent_forward_list_init(STL_Concurrent_forward_list *self, size_t nbytes,
+                                     int (*cmp)(const void *, const void *)); /* Constructs the list for the values of size nbytes, ordered by "cmp". Returns STL_Concurrent_forward_list_OK if OK */
+void STL_Concurrent_forward_list_delete(STL_Concurrent_forward_list *self); /* Destructs the list */
+
+/* Threads */
+STL_Concurrent_forward_list_thread *STL_Concurrent_forward_list_attach(
+    STL_Concurrent_forward_list *self); /* Returns a record for the calling thread, NULL if out of memory */
+void STL_Concurrent_forward_list_detach(STL_Concurrent_forward_list *self,
+                                        STL_Concurrent_forward_list_thread *thread); /* Gives the record back for reuse */
+
+/* Capacity */
+int STL_Concurrent_forward_list_empty(STL_Concurrent_forward_list *self); /* Checks whether the container is empty */
+size_t STL_Concurrent_forward_list_size(STL_Concurrent_forward_list *self); /* Returns the number of elements */
+
+/* Modifiers */
+int STL_Concurrent_forward_list_insert(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *thread,
+                                       const void *elem); /* Inserts elem unless an equal one is there. Returns STL_Concurrent_forward_list_OK if OK */
+int STL_Concurrent_forward_list_erase(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *thread,
+                                      const void *elem); /* Erases the element equal to elem. Returns STL_Concurrent_forward_list_OK if OK */
+
+/* Lookup */
+int STL_Concurrent_forward_list_contains(STL_Concurrent_forward_list *self, STL_Concurrent_forward_list_thread *thread,
+                                         const void *elem); /* Checks whether an element equal to elem is there */
+
+#endif
@@ -58,9 +58,15 @@ STL_Forward_list_node *STL_Forward_list_end(STL_Forward_list *list); /* Returns
 /* Capacity */
 int STL_Forward_list_empty(STL_Forward_list *list); /* Checks whether the container is empty */
 size_t STL_Forward_list_size(STL_Forward_list *list); /* Returns the number of elements */
+double STL_Forward_list_fragmentation(
+    STL_Forward_list *list); /* Returns the share of nodes not stored right after the previous one, 0 if compact */
 
 /* Modifiers */
-void STL_Forward_list_clear(STL_Forward_list *list); /* Clears the contents */
+void STL_Forward_list_clear(STL_Forward_list *list); /* Clears the contents, releasing the node pool */
+int STL_Forward_list_reserve(STL_Forward_list *list, size_t n,
+                             size_t size); /* Pre-sizes the node pool for "n" elements of size "size". Returns STL_Forward_list_OK if OK */
+int STL_Forward_list_compact(
+    STL_Forward_list *list); /* Moves all nodes into one fresh slab in list order. Invalidates nodes. Returns STL_Forward_list_OK if OK */
 
 int STL_Forward_list_insert_after(STL_Forward_list *list, const void *elem, size_t size,
                                   STL_Forward_list_node *pos); /* Inserts element of size "size" at address "elem" after "pos". Returns STL_Forward_list_OK if OK */
@@ -75,15 +81,29 @@ STL_Forward_list_node *STL_Forward_list_pop_front(
 void STL_Forward_list_swap(STL_Forward_list *self,
                            STL_Forward_list *other); /* Swaps the contents of two STL_Forward_lists */
 
-/* Operations */
+/* Operations. Nodes are only relinked: elements never move in memory */
 void STL_Forward_list_merge(STL_Forward_list *self, STL_Forward_list *other, int (*cmp)(const void *,
-                                                                                        const void *)); /* Merges two sorted lists into one. The lists should be sorted into ascending order */
+                                                                                        const void *)); /* Moves the nodes of "other" into "self". Both should be sorted into ascending order */
+int STL_Forward_list_splice_after(STL_Forward_list *self, STL_Forward_list_node *pos,
+                                  STL_Forward_list *other); /* Moves all nodes of "other" after "pos". Returns STL_Forward_list_OK if OK */
+int STL_Forward_list_splice_after_node(STL_Forward_list *self, STL_Forward_list_node *pos, STL_Forward_list *other,
+                                       STL_Forward_list_node *before); /* Moves the node after "before" of "other" after "pos". Returns STL_Forward_list_OK if OK */
+int STL_Forward_list_splice_after_range(STL_Forward_list *self, STL_Forward_list_node *pos, STL_Forward_list *other,
+                                        STL_Forward_list_node *first,
+                                        STL_Forward_list_node *last); /* Moves nodes of "other" between "first" and "last" after "pos". Returns STL_Forward_list_OK if OK */
+size_t STL_Forward_list_remove_if(STL_Forward_list *list, int (*pred)(const void *, void *),
+                                  void *arg); /* Removes elements for which "pred" is true. Returns the number removed */
+size_t STL_Forward_list_unique(STL_Forward_list *list, int (*cmp)(const void *,
+                                                                  const void *)); /* Removes consecutive equal elements. Returns the number removed */
+STL_Forward_list_node *STL_Forward_list_partition(STL_Forward_list *list, int (*pred)(const void *, void *),
+                                                  void *arg); /* Stable: moves elements for which "pred" is false to the end. Returns the first of them */
 void STL_Forward_list_reverse(STL_Forward_list *self); /* Reverses the order of elements */
-void STL_Forward_list_sort(STL_Forward_list *list, size_t n, int (*cmp)(const void *, const void *)); /* Sorts the list */
+void STL_Forward_list_sort(STL_Forward_list *list, size_t n,
+                           int (*cmp)(const void *, const void *)); /* Stable sort of the first "n" elements, all if "n" is too big */
 
 /* Miscellaneous routines */
-void STL_Forward_list_swap_nodes(STL_Forward_list_node *self_node,
-                                 STL_Forward_list_node *other_node); /* Swaps the contents of two STL_Forward_list_nodes */
+int STL_Forward_list_swap_nodes(STL_Forward_list_node *self_node,
+                                STL_Forward_list_node *other_node); /* Swaps the contents of two STL_Forward_list_nodes of the same size. Returns STL_Forward_list_OK if OK */
 size_t STL_Forward_list_size_node(STL_Forward_list_node *node); /* Returns the size of the STL_Forward_list_node->elem */
 
 #endif
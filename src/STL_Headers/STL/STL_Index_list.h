@@ -0,0 +1,103 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_INDEX_LIST_H
+#define SRC_STL_INDEX_LIST_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Definition of STL_Index_list_links: what every slot starts with, its element following 8-byte aligned */
+typedef struct __STL_Index_list_links {
+    uint32_t next;
+    uint32_t prev;
+} STL_Index_list_links;
+
+/* Definition of STL_Index_list: a doubly-linked list of elements of one size, all in one array of slots */
+typedef struct __STL_Index_list {
+    void *slots; /* Slot 0 is the end one, linked to the last and first elements. NULL until the first insertion */
+
+    size_t nbytes;
+    size_t stride;   /* Bytes per slot */
+    size_t nelem;
+    size_t capacity; /* Slots allocated, the end one included */
+    uint32_t free;   /* First unused slot, 0 if none */
+} STL_Index_list;
+
+/* STL_Index_list errors */
+enum STL_Index_list_errors {
+    STL_Index_list_OK = 1,                /* Everything is OK. Not an error */
+    STL_Index_list_memory_error,          /* If STL_Index_list routine can't allocate memory */
+    STL_Index_list_index_error,           /* If desired position is wrong */
+    STL_Index_list_null_reference_error   /* If (STL_Index_list *) or (const void *elem) is NULL */
+};
+
+/* STL_Index_list states */
+enum STL_Index_list_states {
+    index_list_not_empty = 0,
+    index_list_is_empty
+};
+
+/* STL_Index_list methods */
+/* Elements are addressed by slot indices, which stay valid until erased, even when the slots are moved */
+/* Construction and destruction */
+int STL_Index_list_init(STL_Index_list *self,
+                        size_t nbytes); /* Constructs the list for the values of size nbytes. Returns STL_Index_list_OK if OK */
+int STL_Index_list_init_cpy(STL_Index_list *self, STL_Index_list *other); /* Copies the list. Returns STL_Index_list_OK if OK */
+int STL_Index_list_init_data(STL_Index_list *self, size_t nbytes, const void *data,
+                             size_t size); /* Constructs the list from "size" bytes of data() of a list for values of size nbytes. Returns STL_Index_list_index_error if they don't link up, STL_Index_list_OK if OK */
+void STL_Index_list_delete(STL_Index_list *self); /* Destructs the list */
+
+/* Element access */
+void *STL_Index_list_front(STL_Index_list *self); /* Accesses the first element */
+void *STL_Index_list_back(STL_Index_list *self); /* Accesses the last element */
+const void *STL_Index_list_data(const STL_Index_list *self); /* Direct access to the slots. They can be saved and copied as they are */
+size_t STL_Index_list_data_size(const STL_Index_list *self); /* Returns the number of bytes of the slots */
+
+/* Kinda iterators */
+uint32_t STL_Index_list_begin(STL_Index_list *self); /* Returns the slot of the first element */
+uint32_t STL_Index_list_end(STL_Index_list *self); /* Returns the end slot, 0 */
+void *STL_Index_list_get(STL_Index_list *self, uint32_t pos); /* Accesses the element in slot "pos", NULL at the end */
+uint32_t STL_Index_list_next(STL_Index_list *self, uint32_t pos); /* Returns the slot following "pos" */
+uint32_t STL_Index_list_prev(STL_Index_list *self, uint32_t pos); /* Returns the slot preceding "pos" */
+
+/* Capacity */
+int STL_Index_list_empty(STL_Index_list *self); /* Checks whether the container is empty */
+size_t STL_Index_list_size(STL_Index_list *self); /* Returns the number of elements */
+int STL_Index_list_reserve(STL_Index_list *self,
+                           size_t new_cap); /* Makes room for "new_cap" elements without reallocation. Returns STL_Index_list_OK if OK */
+size_t STL_Index_list_capacity(STL_Index_list *self); /* Returns the number of elements that can be held in currently allocated storage */
+
+/* Modifiers */
+void STL_Index_list_clear(STL_Index_list *self); /* Clears the contents, keeping the slots */
+
+int STL_Index_list_insert(STL_Index_list *self, uint32_t *pos,
+                          const void *elem); /* Inserts elem before "pos", then points "pos" to it. Returns STL_Index_list_OK if OK */
+int STL_Index_list_erase(STL_Index_list *self,
+                         uint32_t *pos); /* Erases element at "pos", then points "pos" to the one following it. Returns STL_Index_list_OK if OK */
+
+int STL_Index_list_push_back(STL_Index_list *self, const void *elem); /* Adds element to the end. Returns STL_Index_list_OK if OK */
+void STL_Index_list_pop_back(STL_Index_list *self); /* Removes the last element */
+int STL_Index_list_push_front(STL_Index_list *self, const void *elem); /* Adds element to the beginning. Returns STL_Index_list_OK if OK */
+void STL_Index_list_pop_front(STL_Index_list *self); /* Removes the first element */
+
+void STL_Index_list_swap(STL_Index_list *self, STL_Index_list *other); /* Swaps the contents */
+
+#endif
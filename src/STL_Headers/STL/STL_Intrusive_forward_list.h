@@ -0,0 +1,102 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_INTRUSIVE_FORWARD_LIST_H
+#define SRC_STL_INTRUSIVE_FORWARD_LIST_H
+
+#include <stddef.h>
+
+/* Definition of STL_Intrusive_forward_list_hook: the link, embedded in the user's struct */
+typedef struct __STL_Intrusive_forward_list_hook {
+    struct __STL_Intrusive_forward_list_hook *next;
+} STL_Intrusive_forward_list_hook;
+
+/* Definition of STL_Intrusive_forward_list: a singly-linked list of hooks, ending with NULL. It never allocates */
+typedef struct __STL_Intrusive_forward_list {
+    STL_Intrusive_forward_list_hook head; /* Hook before the first one */
+    size_t size;
+} STL_Intrusive_forward_list;
+
+/* Returns a pointer to the struct of type "type" whose member "member" is the hook at "hook" */
+#define STL_Intrusive_forward_list_entry(hook, type, member) ((type *) ((char *) (hook) - offsetof(type, member)))
+
+/* STL_Intrusive_forward_list errors */
+enum STL_Intrusive_forward_list_errors {
+    STL_Intrusive_forward_list_OK = 1,                /* Everything is OK. Not an error */
+    STL_Intrusive_forward_list_index_error,           /* If desired position is wrong */
+    STL_Intrusive_forward_list_null_reference_error   /* If (STL_Intrusive_forward_list *) or (STL_Intrusive_forward_list_hook *) is NULL */
+};
+
+/* STL_Intrusive_forward_list states */
+enum STL_Intrusive_forward_list_states {
+    intrusive_forward_list_not_empty = 0,
+    intrusive_forward_list_is_empty
+};
+
+/* STL_Intrusive_forward_list methods */
+/* Construction */
+int STL_Intrusive_forward_list_init(
+    STL_Intrusive_forward_list *list); /* Constructs the list. Returns STL_Intrusive_forward_list_OK if OK */
+
+/* Element access */
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_front(
+    STL_Intrusive_forward_list *list); /* Accesses the first hook, NULL if empty */
+
+/* Kinda iterators */
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_before_begin(
+    STL_Intrusive_forward_list *list); /* Returns the head */
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_begin(STL_Intrusive_forward_list *list); /* Returns the first hook */
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_end(STL_Intrusive_forward_list *list); /* Returns NULL */
+
+/* Capacity */
+int STL_Intrusive_forward_list_empty(const STL_Intrusive_forward_list *list); /* Checks whether the container is empty */
+size_t STL_Intrusive_forward_list_size(const STL_Intrusive_forward_list *list); /* Returns the number of elements */
+
+/* Modifiers */
+void STL_Intrusive_forward_list_clear(STL_Intrusive_forward_list *list); /* Unlinks all hooks. The objects themselves are left alone */
+
+int STL_Intrusive_forward_list_insert_after(STL_Intrusive_forward_list *list, STL_Intrusive_forward_list_hook *pos,
+                                            STL_Intrusive_forward_list_hook *hook); /* Links "hook" after "pos". Returns STL_Intrusive_forward_list_OK if OK */
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_erase_after(STL_Intrusive_forward_list *list,
+                                                                        STL_Intrusive_forward_list_hook *pos); /* Unlinks the hook after "pos". Returns the hook after it if OK */
+
+int STL_Intrusive_forward_list_push_front(STL_Intrusive_forward_list *list,
+                                          STL_Intrusive_forward_list_hook *hook); /* Links "hook" at the first position. Returns STL_Intrusive_forward_list_OK if OK */
+STL_Intrusive_forward_list_hook *STL_Intrusive_forward_list_pop_front(
+    STL_Intrusive_forward_list *list); /* Unlinks the first hook. Returns it, NULL if empty */
+
+void STL_Intrusive_forward_list_swap(STL_Intrusive_forward_list *self,
+                                     STL_Intrusive_forward_list *other); /* Swaps the contents of two STL_Intrusive_forward_lists */
+
+/* Operations */
+int STL_Intrusive_forward_list_splice_after(STL_Intrusive_forward_list *self, STL_Intrusive_forward_list_hook *pos,
+                                            STL_Intrusive_forward_list *other); /* Moves all hooks of "other" after "pos". Returns STL_Intrusive_forward_list_OK if OK */
+int STL_Intrusive_forward_list_splice_after_hook(STL_Intrusive_forward_list *self, STL_Intrusive_forward_list_hook *pos,
+                                                 STL_Intrusive_forward_list *other,
+                                                 STL_Intrusive_forward_list_hook *before); /* Moves the hook after "before" of "other" after "pos". Returns STL_Intrusive_forward_list_OK if OK */
+int STL_Intrusive_forward_list_splice_after_range(STL_Intrusive_forward_list *self, STL_Intrusive_forward_list_hook *pos,
+                                                  STL_Intrusive_forward_list *other, STL_Intrusive_forward_list_hook *first,
+                                                  STL_Intrusive_forward_list_hook *last); /* Moves hooks of "other" between "first" and "last" after "pos". Returns STL_Intrusive_forward_list_OK if OK */
+void STL_Intrusive_forward_list_reverse(STL_Intrusive_forward_list *list); /* Reverses the order of elements */
+void STL_Intrusive_forward_list_sort(STL_Intrusive_forward_list *list,
+                                     int (*cmp)(const STL_Intrusive_forward_list_hook *,
+                                                const STL_Intrusive_forward_list_hook *)); /* Stable sort of all elements */
+
+#endif
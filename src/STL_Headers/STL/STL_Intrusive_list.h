@@ -0,0 +1,102 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_INTRUSIVE_LIST_H
+#define SRC_STL_INTRUSIVE_LIST_H
+
+#include <stddef.h>
+
+/* Definition of STL_Intrusive_list_hook: the links, embedded in the user's struct */
+typedef struct __STL_Intrusive_list_hook {
+    struct __STL_Intrusive_list_hook *next;
+    struct __STL_Intrusive_list_hook *prev;
+} STL_Intrusive_list_hook;
+
+/* Definition of STL_Intrusive_list: a doubly-linked list of hooks. It never allocates */
+typedef struct __STL_Intrusive_list {
+    STL_Intrusive_list_hook head; /* End sentinel: "next" is the first hook and "prev" the last one */
+    size_t size;
+} STL_Intrusive_list;
+
+/* Returns a pointer to the struct of type "type" whose member "member" is the hook at "hook" */
+#define STL_Intrusive_list_entry(hook, type, member) ((type *) ((char *) (hook) - offsetof(type, member)))
+
+/* STL_Intrusive_list errors */
+enum STL_Intrusive_list_errors {
+    STL_Intrusive_list_OK = 1,                /* Everything is OK. Not an error */
+    STL_Intrusive_list_index_error,           /* If desired position is wrong */
+    STL_Intrusive_list_null_reference_error   /* If (STL_Intrusive_list *) or (STL_Intrusive_list_hook *) is NULL */
+};
+
+/* STL_Intrusive_list states */
+enum STL_Intrusive_list_states {
+    intrusive_list_not_empty = 0,
+    intrusive_list_is_empty
+};
+
+/* STL_Intrusive_list methods */
+/* The list points into its own head, so it must not be copied or moved while in use: swap instead */
+/* Construction */
+int STL_Intrusive_list_init(STL_Intrusive_list *list); /* Constructs the list. Returns STL_Intrusive_list_OK if OK */
+void STL_Intrusive_list_hook_init(STL_Intrusive_list_hook *hook); /* Marks the hook as not linked into any list */
+int STL_Intrusive_list_is_linked(const STL_Intrusive_list_hook *hook); /* Checks whether the hook is in a list */
+
+/* Element access */
+STL_Intrusive_list_hook *STL_Intrusive_list_front(STL_Intrusive_list *list); /* Accesses the first hook, NULL if empty */
+STL_Intrusive_list_hook *STL_Intrusive_list_back(STL_Intrusive_list *list); /* Accesses the last hook, NULL if empty */
+
+/* Kinda iterators */
+STL_Intrusive_list_hook *STL_Intrusive_list_begin(STL_Intrusive_list *list); /* Returns the first hook */
+STL_Intrusive_list_hook *STL_Intrusive_list_end(STL_Intrusive_list *list); /* Returns the head */
+
+/* Capacity */
+int STL_Intrusive_list_empty(const STL_Intrusive_list *list); /* Checks whether the container is empty */
+size_t STL_Intrusive_list_size(const STL_Intrusive_list *list); /* Returns the number of elements */
+
+/* Modifiers */
+void STL_Intrusive_list_clear(STL_Intrusive_list *list); /* Unlinks all hooks. The objects themselves are left alone */
+
+int STL_Intrusive_list_insert(STL_Intrusive_list *list, STL_Intrusive_list_hook *pos,
+                              STL_Intrusive_list_hook *hook); /* Links "hook" before "pos". Returns STL_Intrusive_list_OK if OK */
+STL_Intrusive_list_hook *STL_Intrusive_list_erase(STL_Intrusive_list *list,
+                                                  STL_Intrusive_list_hook *hook); /* Unlinks "hook". Returns the hook after it if OK */
+
+int STL_Intrusive_list_push_back(STL_Intrusive_list *list,
+                                 STL_Intrusive_list_hook *hook); /* Links "hook" at the last position. Returns STL_Intrusive_list_OK if OK */
+STL_Intrusive_list_hook *STL_Intrusive_list_pop_back(STL_Intrusive_list *list); /* Unlinks the last hook. Returns it, NULL if empty */
+int STL_Intrusive_list_push_front(STL_Intrusive_list *list,
+                                  STL_Intrusive_list_hook *hook); /* Links "hook" at the first position. Returns STL_Intrusive_list_OK if OK */
+STL_Intrusive_list_hook *STL_Intrusive_list_pop_front(STL_Intrusive_list *list); /* Unlinks the first hook. Returns it, NULL if empty */
+
+void STL_Intrusive_list_swap(STL_Intrusive_list *self, STL_Intrusive_list *other); /* Swaps the contents of two STL_Intrusive_lists */
+
+/* Operations */
+int STL_Intrusive_list_splice(STL_Intrusive_list *self, STL_Intrusive_list_hook *pos,
+                              STL_Intrusive_list *other); /* Moves all hooks of "other" before "pos". Returns STL_Intrusive_list_OK if OK */
+int STL_Intrusive_list_splice_hook(STL_Intrusive_list *self, STL_Intrusive_list_hook *pos, STL_Intrusive_list *other,
+                                   STL_Intrusive_list_hook *hook); /* Moves "hook" of "other" before "pos". Returns STL_Intrusive_list_OK if OK */
+int STL_Intrusive_list_splice_range(STL_Intrusive_list *self, STL_Intrusive_list_hook *pos, STL_Intrusive_list *other,
+                                    STL_Intrusive_list_hook *first,
+                                    STL_Intrusive_list_hook *last); /* Moves hooks of "other" from "first" up to "last" before "pos". Returns STL_Intrusive_list_OK if OK */
+void STL_Intrusive_list_reverse(STL_Intrusive_list *list); /* Reverses the order of elements */
+void STL_Intrusive_list_sort(STL_Intrusive_list *list, int (*cmp)(const STL_Intrusive_list_hook *,
+                                                                  const STL_Intrusive_list_hook *)); /* Stable sort of all elements */
+
+#endif
@@ -53,20 +53,27 @@ void *STL_List_back(const STL_List *l); /* Accesses the last element */
 /* Kinda iterators */
 STL_List_node *STL_List_begin(STL_List *list); /* Returns STL_List->bp */
 STL_List_node *STL_List_end(STL_List *list); /* Returns STL_List->lp */
+STL_List_node *STL_List_node_at(STL_List *list, size_t pos); /* Returns the node at "pos", the end node if "pos" is too big */
 
 /* Capacity */
 int STL_List_empty(STL_List *list); /* Checks whether the container is empty */
 size_t STL_List_size(STL_List *list); /* Returns the number of elements */
+double STL_List_fragmentation(STL_List *list); /* Returns the share of nodes not stored right after the previous one, 0 if compact */
 
 /* Modifiers */
-void STL_List_clear(STL_List *list); /* Clears the contents */
+void STL_List_clear(STL_List *list); /* Clears the contents, releasing the node pool */
+int STL_List_reserve(STL_List *list, size_t n,
+                     size_t size); /* Pre-sizes the node pool for "n" elements of size "size". Returns STL_List_OK if OK */
+int STL_List_compact(STL_List *list); /* Moves all nodes into one fresh slab in list order. Invalidates nodes. Returns STL_List_OK if OK */
+int STL_List_enable_index(STL_List *list); /* Makes positional access, insertion and erasure O(log n). Returns STL_List_OK if OK */
+void STL_List_disable_index(STL_List *list); /* Frees the positional index */
 
 int STL_List_insert_at(STL_List *list, const void *elem, size_t size,
-                       size_t pos); /* Inserts element of size "size" at address "elem" before "pos". Returns STL_List_OK if OK */
+                       size_t pos); /* Inserts element of size "size" at address "elem" at position "pos". Returns STL_List_OK if OK */
 int STL_List_insert(STL_List *list, const void *elem, size_t size,
                     STL_List_node *pos); /* Inserts element of size "size" at address "elem" before "pos". Returns STL_List_OK if OK */
 STL_List_node *STL_List_erase_at(STL_List *list,
-                                 size_t pos); /* Removes element before "pos". Returns node after deleted element if OK */
+                                 size_t pos); /* Removes element at position "pos". Returns node after deleted element if OK */
 STL_List_node *STL_List_erase(STL_List *list,
                               STL_List_node *pos); /* Removes element at "pos". Returns node after deleted element if OK */
 
@@ -81,14 +88,28 @@ STL_List_node *STL_List_pop_front(
 
 void STL_List_swap(STL_List *self, STL_List *other); /* Swaps the contents of two STL_Lists */
 
-/* Operations */
+/* Operations. Nodes are only relinked: elements never move in memory */
 void STL_List_merge(STL_List *self, STL_List *other, int (*cmp)(const void *,
-                                                                const void *)); /* Merges two sorted lists into one. The lists should be sorted into ascending order */
+                                                                const void *)); /* Moves the nodes of "other" into "self". Both should be sorted into ascending order */
+int STL_List_splice(STL_List *self, STL_List_node *pos,
+                    STL_List *other); /* Moves all nodes of "other" before "pos". Returns STL_List_OK if OK */
+int STL_List_splice_node(STL_List *self, STL_List_node *pos, STL_List *other,
+                         STL_List_node *node); /* Moves "node" of "other" before "pos". Returns STL_List_OK if OK */
+int STL_List_splice_range(STL_List *self, STL_List_node *pos, STL_List *other, STL_List_node *first,
+                          STL_List_node *last); /* Moves nodes of "other" from "first" up to "last" before "pos". Returns STL_List_OK if OK */
+size_t STL_List_remove_if(STL_List *list, int (*pred)(const void *, void *),
+                          void *arg); /* Removes elements for which "pred" is true. Returns the number removed */
+size_t STL_List_unique(STL_List *list, int (*cmp)(const void *,
+                                                  const void *)); /* Removes consecutive equal elements. Returns the number removed */
+STL_List_node *STL_List_partition(STL_List *list, int (*pred)(const void *, void *),
+                                  void *arg); /* Stable: moves elements for which "pred" is false to the end. Returns the first of them */
 void STL_List_reverse(STL_List *self); /* Reverses the order of elements */
-void STL_List_sort(STL_List *list, size_t n, int (*cmp)(const void *, const void *)); /* Sorts the list */
+void STL_List_sort(STL_List *list, size_t n,
+                   int (*cmp)(const void *, const void *)); /* Stable sort of the first "n" elements, all if "n" is too big */
 
 /* Miscellaneous routines */
-void STL_List_swap_nodes(STL_List_node *self_node, STL_List_node *other_node); /* Swaps the contents of two STL_List_nodes */
+int STL_List_swap_nodes(STL_List_node *self_node,
+                        STL_List_node *other_node); /* Swaps the contents of two STL_List_nodes of the same size. Returns STL_List_OK if OK */
 size_t STL_List_size_node(STL_List_node *node); /* Returns the size of the STL_List_node->elem */
 
 #endif
@@ -26,8 +26,26 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 /* Include STL_List type definition */
 #include "__internal/__STL_List_type.h"
 
-/* Definition of STL_Queue type */
-typedef STL_List STL_Stack;
+/* Bytes of elements a vector-backed STL_Stack keeps inside itself before allocating */
+#define STL_STACK_INLINE_BYTES 128
+
+/* Definition of STL_Stack type: elements in list nodes, or in one array for a vector-backed stack */
+typedef struct __STL_Stack {
+    STL_List list; /* Elements of a list-backed stack */
+
+    char *data;      /* Elements of a vector-backed stack: the inline block, or a heap one once it is outgrown */
+    char *top;       /* Last element of a vector-backed stack, NULL if empty */
+    size_t nbytes;   /* Element size of a vector-backed stack, 0 for a list-backed one */
+    size_t nelem;
+    size_t max_nelem;
+
+    union {
+        char bytes[STL_STACK_INLINE_BYTES];
+        void *align_pointer;
+        double align_double;
+        long align_long;
+    } inline_block;
+} STL_Stack;
 typedef STL_List_node STL_Stack_node;
 
 /* STL_Stack errors */
@@ -46,7 +64,9 @@ enum STL_Stack_states {
 
 /* STL_Stack methods */
 /* Construction and destruction */
-int STL_Stack_init(STL_Stack *self); /* Constructs the stack. Returns STL_Stack_OK if OK */
+int STL_Stack_init(STL_Stack *self); /* Constructs a list-backed stack for elements of any size. Returns STL_Stack_OK if OK */
+int STL_Stack_init_vector(STL_Stack *self,
+                          size_t nbytes); /* Constructs a vector-backed stack for the values of size nbytes. Returns STL_Stack_OK if OK */
 int STL_Stack_init_cpy(STL_Stack *self, STL_Stack *other); /* Copies the stack. Returns STL_Stack_OK if OK */
 void STL_Stack_delete(STL_Stack *stack); /* Destructs the stack */
 
@@ -54,13 +74,18 @@ void STL_Stack_delete(STL_Stack *stack); /* Destructs the stack */
 void *STL_Stack_top(const STL_Stack *stack); /* Accesses stack's top element */
 
 /* Capacity */
-int STL_Stack_empty(const STL_Stack *stack); /* Returns STL_List_states::list_is_empty if STL_Stack->size == 0 */
-size_t STL_Stack_size(const STL_Stack *stack); /* Returns STL_Stack->size */
+int STL_Stack_empty(const STL_Stack *stack); /* Returns STL_Stack_states::stack_is_empty if there are no elements */
+size_t STL_Stack_size(const STL_Stack *stack); /* Returns the number of elements */
 
-/* Modifiers */
+/* Modifiers. A vector-backed stack only takes elements of its own size */
+int STL_Stack_reserve(STL_Stack *stack, size_t n,
+                      size_t nbytes); /* Makes room for "n" elements of size "nbytes". Returns STL_Stack_OK if OK */
 int STL_Stack_push(STL_Stack *stack, const void *elem,
-                   size_t nbytes); /* Inserts element of size "size" at address "elem" at the first position. Returns STL_Stack_OK if OK */
-void STL_Stack_pop(STL_Stack *stack); /* Removes element at the last position */
+                   size_t nbytes); /* Inserts element of size "nbytes" at address "elem" on top. Returns STL_Stack_OK if OK */
+int STL_Stack_push_n(STL_Stack *stack, const void *elems, size_t n,
+                     size_t nbytes); /* Pushes "n" elements of size "nbytes" stored one after another at "elems", the first one first. Returns STL_Stack_OK if OK */
+void STL_Stack_pop(STL_Stack *stack); /* Removes the top element */
+void STL_Stack_pop_n(STL_Stack *stack, size_t n); /* Removes "n" top elements, all if there are fewer */
 
 void STL_Stack_swap(STL_Stack *self, STL_Stack *other); /* Swaps the contents of two STL_Stacks */
 
@@ -21,11 +21,15 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 #ifndef SRC_STL_STRING_H
 #define SRC_STL_STRING_H
 
+#include <stdarg.h>
 #include <stddef.h>
 
 /* Include STL_Basic_string definition */
 #include "__internal/__STL_Basic_string.h"
 
+/* Include STL_Basic_string_view definition */
+#include "__internal/__STL_Basic_string_view.h"
+
 /* Definition of STL_String */
 typedef STL_Basic_string STL_String;
 
@@ -34,7 +38,12 @@ enum STL_String_errors {
     STL_String_OK = 1,                /* Everything is OK. Not an error */
     STL_String_memory_error,          /* If STL_String routine can't allocate memory */
     STL_String_index_error,           /* If desired position is wrong */
-    STL_String_null_reference_error   /* If (STL_String *) or (const void *elem) is NULL */
+    STL_String_null_reference_error,  /* If (STL_String *) or (const void *elem) is NULL */
+    STL_String_encoding_error,        /* If characters are not valid in the requested encoding */
+    STL_String_io_error,              /* If reading from a file descriptor fails */
+    STL_String_end_of_file,           /* If there is nothing left to read. Not an error */
+    STL_String_parse_error,           /* If the characters don't form a number */
+    STL_String_range_error            /* If the number doesn't fit the requested type */
 };
 
 /* STL_String states */
@@ -46,7 +55,9 @@ enum STL_String_states {
 /* STL_String methods */
 /* Construction and destruction */
 int STL_String_init(STL_String *self); /* Constructs a string. Returns STL_String_OK if OK */
-int STL_String_init_cpy(STL_String *self, STL_String *other); /* Copies the string. Returns STL_String_OK if OK */
+int STL_String_init_cpy(STL_String *self,
+                        STL_String *other); /* Copies the string, sharing the buffer of a shared one. Returns STL_String_OK if OK */
+int STL_String_share(STL_String *self); /* Makes the buffer shared: copies are O(1) until one of them is written. Returns STL_String_OK if OK */
 void STL_String_delete(STL_String *self); /* Destroys the string, deallocating internal storage if used */
 
 /* Element access */
@@ -75,6 +86,8 @@ void STL_String_clear(STL_String *self); /* Clears the contents */
 
 int STL_String_insert(STL_String *self, size_t pos, char ch, size_t count); /* Inserts characters */
 int STL_String_insert_str(STL_String *self, size_t pos, const char *str); /* Inserts substring */
+int STL_String_insert_str_n(STL_String *self, size_t pos, const char *str,
+                            size_t count); /* Inserts "count" characters at "str", which may contain zeros */
 
 void STL_String_erase(STL_String *self, size_t pos, size_t count); /* Removes characters */
 
@@ -83,13 +96,31 @@ void STL_String_pop_back(STL_String *self); /* Removes the last character */
 
 void STL_String_append(STL_String *self, char ch, size_t count); /* Appends characters to the end */
 void STL_String_append_str(STL_String *self, const char *str); /* Appends substring to the end */
+void STL_String_append_str_n(STL_String *self, const char *str,
+                             size_t count); /* Appends "count" characters at "str" to the end */
+int STL_String_appendf(STL_String *self, const char *format, ...); /* Appends printf()-formatted text to the end */
+int STL_String_vappendf(STL_String *self, const char *format,
+                        va_list args); /* Appends vprintf()-formatted text to the end */
 
 int STL_String_compare(STL_String *self, STL_String *other); /* Compares two strings */
 int STL_String_starts_with(STL_String *self, const char *prefix); /* Checks if the string starts with the given prefix */
+int STL_String_starts_with_n(STL_String *self, const char *prefix,
+                             size_t count); /* Checks if the string starts with "count" characters at "prefix" */
 int STL_String_ends_with(STL_String *self, const char *prefix); /* Checks if the string ends with the given prefix */
-
-void STL_String_replace(STL_String *self, size_t pos, const char *str, size_t count); /* Replaces specified portion of a string */
+int STL_String_ends_with_n(STL_String *self, const char *suffix,
+                           size_t count); /* Checks if the string ends with "count" characters at "suffix" */
+
+void STL_String_replace(STL_String *self, size_t pos, const char *str,
+                        size_t count); /* Replaces "count" characters starting at "pos" with "str" */
+int STL_String_replace_n(STL_String *self, size_t pos, size_t count, const char *str,
+                         size_t str_count); /* Replaces "count" characters starting at "pos" with "str_count" characters at "str" */
+int STL_String_replace_all(STL_String *self, const char *pattern,
+                           const char *str); /* Replaces every occurrence of "pattern" with "str". Returns STL_String_OK if OK */
+int STL_String_replace_first_n(STL_String *self, const char *pattern, const char *str,
+                               size_t n); /* Replaces the first "n" occurrences of "pattern" with "str". Returns STL_String_OK if OK */
 STL_String STL_String_substr(STL_String *self, size_t pos, size_t count); /* Returns a substring */
+STL_Basic_string_view STL_String_substr_view(STL_String *self, size_t pos,
+                                             size_t count); /* Returns a view of a substring without copying */
 
 size_t STL_String_copy(STL_String *self, char *dest, size_t count, size_t pos); /* Copies characters */
 int STL_String_resize(STL_String *self, size_t count); /* Changes the number of characters stored */
@@ -98,7 +129,10 @@ void STL_String_swap(STL_String *self, STL_String *other); /* Swaps the contents
 
 /* Search */
 size_t STL_String_find(STL_String *self, const char *str); /* Find characters in the string */
+size_t STL_String_find_n(STL_String *self, const char *str, size_t count); /* Find "count" characters at "str" in the string */
 size_t STL_String_rfind(STL_String *self, const char *str); /* Find the last occurrence of a substring */
+size_t STL_String_rfind_n(STL_String *self, const char *str,
+                          size_t count); /* Find the last occurrence of "count" characters at "str" */
 
 size_t STL_String_find_first_of(STL_String *self, const char *str); /* Find the first occurrence of characters */
 size_t STL_String_find_first_not_of(STL_String *self, const char *str); /* Find the first absence of characters */
@@ -107,4 +141,46 @@ size_t STL_String_find_last_not_of(STL_String *self, const char *str); /* Find t
 
 size_t STL_String_npos(); /* Special value. The exact meaning depends on the context */
 
+/* Case-insensitive operations. Only ASCII letters are folded */
+void STL_String_to_lower(STL_String *self); /* Converts ASCII letters to lowercase in place */
+void STL_String_to_upper(STL_String *self); /* Converts ASCII letters to uppercase in place */
+int STL_String_icompare(STL_String *self, STL_String *other); /* Compares two strings ignoring case */
+int STL_String_iequal(STL_String *self, STL_String *other); /* Checks if two strings are equal ignoring case */
+int STL_String_istarts_with(STL_String *self, const char *prefix); /* Checks if the string starts with the given prefix ignoring case */
+int STL_String_istarts_with_n(STL_String *self, const char *prefix,
+                              size_t count); /* Checks if the string starts with "count" characters at "prefix" ignoring case */
+size_t STL_String_ifind(STL_String *self, const char *str); /* Find characters in the string ignoring case */
+size_t STL_String_ifind_n(STL_String *self, const char *str,
+                          size_t count); /* Find "count" characters at "str" in the string ignoring case */
+
+/* Numeric conversions. Locale-independent: the decimal point is always '.' */
+int STL_String_parse_llong(STL_String *self, long long *value,
+                           size_t *nparsed); /* Parses a decimal integer at the start of the string. Returns STL_String_OK if OK */
+int STL_String_parse_ullong(STL_String *self, unsigned long long *value,
+                            size_t *nparsed); /* Parses an unsigned decimal integer at the start of the string. Returns STL_String_OK if OK */
+int STL_String_parse_double(STL_String *self, double *value,
+                            size_t *nparsed); /* Parses a correctly rounded double at the start of the string. Returns STL_String_OK if OK */
+int STL_String_append_llong(STL_String *self, long long value); /* Appends the decimal form of "value" */
+int STL_String_append_ullong(STL_String *self, unsigned long long value); /* Appends the decimal form of "value" */
+int STL_String_append_double(STL_String *self,
+                             double value); /* Appends the shortest form of "value" that reads back exactly */
+
+/* Hashing */
+uint64_t STL_String_hash(STL_String *self); /* Returns the 64-bit hash of the string. Cached until the string is modified */
+uint64_t STL_String_hash_seed(STL_String *self, uint64_t seed); /* Returns the 64-bit hash of the string for a custom seed */
+int STL_String_equal(STL_String *self, STL_String *other); /* Checks if two strings hold the same characters */
+
+/* Unicode. UTF-16 and UTF-32 strings use charWidth 2 and 4 and native byte order */
+int STL_String_utf8_validate(STL_String *self); /* Returns STL_String_OK if the string is valid UTF-8 */
+size_t STL_String_utf8_length(STL_String *self); /* Returns the number of code points in a valid UTF-8 string */
+
+int STL_String_utf8_to_utf16(STL_String *dest,
+                             const STL_Basic_string_view *src); /* Replaces "dest" with UTF-16 transcoding of "src". Returns STL_String_OK if OK */
+int STL_String_utf8_to_utf32(STL_String *dest,
+                             const STL_Basic_string_view *src); /* Replaces "dest" with UTF-32 transcoding of "src". Returns STL_String_OK if OK */
+int STL_String_utf16_to_utf8(STL_String *dest,
+                             STL_String *src); /* Replaces "dest" with UTF-8 transcoding of UTF-16 "src". Returns STL_String_OK if OK */
+int STL_String_utf32_to_utf8(STL_String *dest,
+                             STL_String *src); /* Replaces "dest" with UTF-8 transcoding of UTF-32 "src". Returns STL_String_OK if OK */
+
 #endif
@@ -0,0 +1,57 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_STRING_MAP_H
+#define SRC_STL_STRING_MAP_H
+
+#include <stddef.h>
+
+/* Include STL_String_view definition */
+#include "STL_String_view.h"
+
+/* Definition of STL_String_map: read-only memory mapping of a file region, searched through its view */
+typedef struct __STL_String_map {
+    void *addr;           /* Start of the mapping, page aligned. NULL for an empty region */
+    size_t length;        /* Length of the mapping */
+    STL_String_view view; /* The requested region inside the mapping */
+} STL_String_map;
+
+/* Access patterns passed on to madvise() */
+enum STL_String_map_advice {
+    STL_String_map_normal = 0,   /* No special treatment */
+    STL_String_map_sequential,   /* Read ahead aggressively, drop pages soon after they're read */
+    STL_String_map_random,       /* Don't read ahead */
+    STL_String_map_willneed      /* Start reading the region in now */
+};
+
+/* STL_String_map methods */
+/* Construction and destruction */
+int STL_String_map_init(STL_String_map *self, int fd, size_t pos, size_t count,
+                        int advice); /* Maps "count" bytes at "pos" of "fd", clamped to the end of the file. Returns STL_String_OK if OK */
+int STL_String_map_open(STL_String_map *self, const char *path,
+                        int advice); /* Maps the whole file at "path". Returns STL_String_OK if OK */
+void STL_String_map_delete(STL_String_map *self); /* Unmaps the region. Views of it become invalid */
+
+/* Access */
+STL_String_view STL_String_map_view(const STL_String_map *self); /* Returns a view of the mapped region */
+int STL_String_map_advise(STL_String_map *self, size_t pos, size_t count,
+                          int advice); /* Gives a hint about "count" bytes at "pos" of the view. Returns STL_String_OK if OK */
+
+#endif
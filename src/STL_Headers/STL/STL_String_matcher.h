@@ -0,0 +1,79 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_STRING_MATCHER_H
+#define SRC_STL_STRING_MATCHER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Include STL_String_view definition */
+#include "STL_String_view.h"
+
+/* Definition of STL_String_matcher: Aho-Corasick automaton compiled into a DFA over byte classes */
+typedef struct __STL_String_matcher {
+    char *chars;       /* Patterns added so far, back to back */
+    size_t *offsets;   /* Start of every pattern in "chars", plus the end of the last one */
+    size_t nchars;
+    size_t npatterns;
+    size_t max_nchars;
+    size_t max_npatterns;
+
+    uint32_t *delta;   /* nstates * nclasses transitions. Targets are premultiplied by nclasses, the top bit marks outputs */
+    uint32_t *out;     /* First pattern ending in every state */
+    uint32_t *dict;    /* Nearest proper suffix state with an output */
+    uint32_t *next;    /* Next pattern ending in the same state */
+    size_t nstates;
+    size_t nclasses;
+
+    unsigned char classes[256]; /* Byte to class */
+    unsigned char first[32];    /* Bitmap of the first bytes of all patterns, for skipping in the root state */
+    unsigned char nibbles[32];
+    int prefilter;
+} STL_String_matcher;
+
+/* Definition of STL_String_matcher_state: position in a stream, so input can be fed in pieces */
+typedef struct __STL_String_matcher_state {
+    uint32_t state;
+    size_t offset;
+} STL_String_matcher_state;
+
+/* STL_String_matcher methods */
+/* Construction and destruction */
+int STL_String_matcher_init(STL_String_matcher *self); /* Constructs an empty matcher. Returns STL_String_OK if OK */
+void STL_String_matcher_delete(STL_String_matcher *self); /* Destructs the matcher */
+
+int STL_String_matcher_add(STL_String_matcher *self, const char *pattern,
+                           size_t count); /* Adds a non-empty pattern. Its index is the number of patterns added before it. Returns STL_String_OK if OK */
+int STL_String_matcher_compile(STL_String_matcher *self); /* Builds the automaton for the patterns added. Returns STL_String_OK if OK */
+
+/* Matching. "callback" gets the pattern index and the offset of the match in the stream; nonzero stops the scan */
+void STL_String_matcher_state_init(STL_String_matcher_state *state); /* Resets the state to the start of a stream */
+int STL_String_matcher_feed(const STL_String_matcher *self, STL_String_matcher_state *state, const char *data,
+                            size_t count, int (*callback)(size_t pattern, size_t pos, void *arg),
+                            void *arg); /* Scans the next piece of a stream. Returns STL_String_OK if OK */
+int STL_String_matcher_scan_view(const STL_String_matcher *self, const STL_String_view *view,
+                                 int (*callback)(size_t pattern, size_t pos, void *arg),
+                                 void *arg); /* Scans a whole view. Returns STL_String_OK if OK */
+int STL_String_matcher_scan(const STL_String_matcher *self, STL_String *str,
+                            int (*callback)(size_t pattern, size_t pos, void *arg),
+                            void *arg); /* Scans a whole string. Returns STL_String_OK if OK */
+
+#endif
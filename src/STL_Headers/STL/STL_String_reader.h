@@ -0,0 +1,54 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_STRING_READER_H
+#define SRC_STL_STRING_READER_H
+
+#include <stddef.h>
+
+/* Include STL_String_view definition */
+#include "STL_String_view.h"
+
+/* Definition of STL_String_reader. Reads lines from a file descriptor it doesn't own */
+typedef struct __STL_String_reader {
+    char *buf;
+
+    size_t begin;
+    size_t end;
+    size_t scanned;
+    size_t max_nchar;
+
+    int fd;
+    int eof;
+} STL_String_reader;
+
+/* STL_String_reader methods */
+/* Construction and destruction */
+int STL_String_reader_init(STL_String_reader *self, int fd,
+                           size_t bufsize); /* Constructs a reader with a "bufsize" bytes buffer, 0 for the default. Returns STL_String_OK if OK */
+void STL_String_reader_delete(STL_String_reader *self); /* Destructs the reader. Doesn't close the file descriptor */
+
+/* Reading */
+int STL_String_reader_getline(STL_String_reader *self,
+                              STL_String_view *line); /* Reads a line without '\n' as a view valid until the next read. Returns STL_String_OK if OK */
+int STL_String_reader_append_line(STL_String_reader *self,
+                                  STL_String *line); /* Appends a line without '\n' to the string. Returns STL_String_OK if OK */
+
+#endif
@@ -0,0 +1,74 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_STRING_SPLIT_H
+#define SRC_STL_STRING_SPLIT_H
+
+#include <stddef.h>
+
+/* Include STL_String_view definition */
+#include "STL_String_view.h"
+
+/* Include STL_Vector definition */
+#include "STL_Vector.h"
+
+/* Definition of STL_String_token: a field of "nchar" characters at offset "pos" of the split view */
+typedef struct __STL_String_token {
+    size_t pos;
+    size_t nchar;
+} STL_String_token;
+
+/* STL_String_split delimiter modes */
+enum STL_String_split_modes {
+    STL_String_split_char = 0, /* Fields are separated by a single character */
+    STL_String_split_str,      /* Fields are separated by the whole "delim" sequence */
+    STL_String_split_any       /* Fields are separated by any of the characters in "delim" */
+};
+
+/* Definition of STL_String_tokenizer. Doesn't own the source or the delimiter */
+typedef struct __STL_String_tokenizer {
+    STL_String_view src;
+
+    const char *delim;
+    size_t delim_len;
+
+    size_t pos;
+    int mode;
+    int skip_empty;
+    int done;
+
+    unsigned char set[32];     /* Bitmap of the delimiter characters */
+    unsigned char nibbles[32]; /* The same set indexed by the low nibble, for the SIMD scanner */
+} STL_String_tokenizer;
+
+/* STL_String_split methods */
+int STL_String_split(const STL_String_view *src, const char *delim, size_t delim_len, int mode, int skip_empty,
+                     STL_Vector *tokens); /* Appends the fields of "src" to a vector of STL_String_token. Returns STL_String_OK if OK */
+
+/* STL_String_tokenizer methods. Never allocate */
+int STL_String_tokenizer_init(STL_String_tokenizer *self, const STL_String_view *src, const char *delim,
+                              size_t delim_len, int mode,
+                              int skip_empty); /* Constructs an iterator over the fields of "src". Returns STL_String_OK if OK */
+int STL_String_tokenizer_next(STL_String_tokenizer *self,
+                              STL_String_token *token); /* Fetches the next field. Returns 1 if there was one, 0 at the end */
+STL_String_view STL_String_tokenizer_view(const STL_String_tokenizer *self,
+                                          const STL_String_token *token); /* Returns the field as a view of the source */
+
+#endif
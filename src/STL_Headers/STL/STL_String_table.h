@@ -0,0 +1,79 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_STRING_TABLE_H
+#define SRC_STL_STRING_TABLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Include STL_String_view definition */
+#include "STL_String_view.h"
+
+/* Definition of STL_String_table_entry */
+typedef struct __STL_String_table_entry {
+    uint64_t offset; /* Start of the string in "chars" */
+    uint32_t nchar;
+    uint32_t prefix; /* First four characters, big-endian and zero-padded, so most comparisons don't touch "chars" */
+} STL_String_table_entry;
+
+/* Definition of STL_String_table: many immutable strings packed into one buffer */
+typedef struct __STL_String_table {
+    char *chars;                     /* Characters of all strings, back to back, in the order they were added */
+    STL_String_table_entry *entries; /* One per string, in table order */
+    size_t nchars;
+    size_t nentries;
+    size_t max_nchars;
+    size_t max_nentries;
+} STL_String_table;
+
+/* STL_String_table methods */
+/* Construction and destruction */
+int STL_String_table_init(STL_String_table *self); /* Constructs an empty table. Returns STL_String_OK if OK */
+void STL_String_table_delete(STL_String_table *self); /* Destructs the table */
+
+/* Element access */
+STL_String_view STL_String_table_at(const STL_String_table *self,
+                                    size_t index); /* Returns a view of the string at "index", valid until the table grows */
+
+/* Capacity */
+size_t STL_String_table_size(const STL_String_table *self); /* Returns the number of strings */
+size_t STL_String_table_nchars(const STL_String_table *self); /* Returns the number of characters of all strings */
+int STL_String_table_reserve(STL_String_table *self, size_t nentries,
+                             size_t nchars); /* Reserves storage for strings and characters. Returns STL_String_OK if OK */
+
+/* Modifiers */
+void STL_String_table_clear(STL_String_table *self); /* Removes all strings, keeping the storage */
+int STL_String_table_push_back(STL_String_table *self, const char *str,
+                               size_t count); /* Appends "count" characters at "str" as a new string. Returns STL_String_OK if OK */
+int STL_String_table_push_back_view(STL_String_table *self,
+                                    const STL_String_view *view); /* Appends the view as a new string. Returns STL_String_OK if OK */
+
+/* Sorting and search. Strings are ordered bytewise, as by memcmp(), a prefix before the longer string */
+int STL_String_table_sort(STL_String_table *self); /* Stable sort that moves entries only. Returns STL_String_OK if OK */
+size_t STL_String_table_lower_bound(const STL_String_table *self, const char *str,
+                                    size_t count); /* Returns the first index of a sorted table not less than "str" */
+
+/* Serialization. The format is independent of the byte order and the order strings were added in */
+int STL_String_table_save(const STL_String_table *self, int fd); /* Writes the table to "fd". Returns STL_String_OK if OK */
+int STL_String_table_load(STL_String_table *self,
+                          int fd); /* Replaces the contents with a table read from "fd". Returns STL_String_OK if OK */
+
+#endif
@@ -0,0 +1,114 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_STRING_VIEW_H
+#define SRC_STL_STRING_VIEW_H
+
+#include <stddef.h>
+
+/* Include STL_String definition, errors and states */
+#include "STL_String.h"
+
+/* Definition of STL_String_view */
+typedef STL_Basic_string_view STL_String_view;
+
+/* STL_String_view methods */
+/* STL_String_view never owns its characters: it stays valid as long as the viewed buffer does */
+/* Construction */
+int STL_String_view_init(STL_String_view *self, const char *str,
+                         size_t count); /* Constructs a view of "count" characters at "str". Returns STL_String_OK if OK */
+int STL_String_view_init_str(STL_String_view *self,
+                             const char *str); /* Constructs a view of a null-terminated string. Returns STL_String_OK if OK */
+int STL_String_view_init_string(STL_String_view *self,
+                                STL_String *str); /* Constructs a view of the whole STL_String. Returns STL_String_OK if OK */
+
+/* Element access */
+const char *STL_String_view_at(const STL_String_view *self, size_t pos); /* Accesses the specified character with bounds checking */
+const char *STL_String_view_front(const STL_String_view *self); /* Accesses the first character */
+const char *STL_String_view_back(const STL_String_view *self); /* Accesses the last character */
+const char *STL_String_view_data(const STL_String_view *self); /* Returns a pointer to the first character of a view */
+
+/* Iterators */
+const char *STL_String_view_begin(const STL_String_view *self); /* Returns an iterator to the beginning */
+const char *STL_String_view_end(const STL_String_view *self); /* Returns an iterator to the end */
+
+/* Capacity */
+int STL_String_view_empty(const STL_String_view *self); /* Checks whether the view is empty */
+size_t STL_String_view_size(const STL_String_view *self); /* Returns the number of characters */
+size_t STL_String_view_length(const STL_String_view *self); /* Returns the number of characters */
+
+/* Modifiers */
+void STL_String_view_remove_prefix(STL_String_view *self, size_t n); /* Shrinks the view by moving its start forward */
+void STL_String_view_remove_suffix(STL_String_view *self, size_t n); /* Shrinks the view by moving its end backward */
+
+/* Operations */
+size_t STL_String_view_copy(const STL_String_view *self, char *dest, size_t count, size_t pos); /* Copies characters */
+STL_String_view STL_String_view_substr(const STL_String_view *self, size_t pos, size_t count); /* Returns a subview without copying */
+
+int STL_String_view_compare(const STL_String_view *self, const STL_String_view *other); /* Compares two views */
+int STL_String_view_starts_with(const STL_String_view *self, const char *prefix); /* Checks if the view starts with the given prefix */
+int STL_String_view_starts_with_n(const STL_String_view *self, const char *prefix,
+                                  size_t count); /* Checks if the view starts with "count" characters at "prefix" */
+int STL_String_view_ends_with(const STL_String_view *self, const char *suffix); /* Checks if the view ends with the given suffix */
+int STL_String_view_ends_with_n(const STL_String_view *self, const char *suffix,
+                                size_t count); /* Checks if the view ends with "count" characters at "suffix" */
+
+/* Search */
+size_t STL_String_view_find(const STL_String_view *self, const char *str); /* Find characters in the view */
+size_t STL_String_view_find_n(const STL_String_view *self, const char *str,
+                              size_t count); /* Find "count" characters at "str" in the view */
+size_t STL_String_view_rfind(const STL_String_view *self, const char *str); /* Find the last occurrence of a substring */
+size_t STL_String_view_rfind_n(const STL_String_view *self, const char *str,
+                               size_t count); /* Find the last occurrence of "count" characters at "str" */
+
+size_t STL_String_view_find_first_of(const STL_String_view *self, const char *str); /* Find the first occurrence of characters */
+size_t STL_String_view_find_first_not_of(const STL_String_view *self, const char *str); /* Find the first absence of characters */
+size_t STL_String_view_find_last_of(const STL_String_view *self, const char *str); /* Find the last occurrence of characters */
+size_t STL_String_view_find_last_not_of(const STL_String_view *self, const char *str); /* Find the last absence of characters */
+
+/* Case-insensitive operations. Only ASCII letters are folded */
+int STL_String_view_icompare(const STL_String_view *self, const STL_String_view *other); /* Compares two views ignoring case */
+int STL_String_view_iequal(const STL_String_view *self,
+                           const STL_String_view *other); /* Checks if two views are equal ignoring case */
+int STL_String_view_istarts_with(const STL_String_view *self,
+                                 const char *prefix); /* Checks if the view starts with the given prefix ignoring case */
+int STL_String_view_istarts_with_n(const STL_String_view *self, const char *prefix,
+                                   size_t count); /* Checks if the view starts with "count" characters at "prefix" ignoring case */
+size_t STL_String_view_ifind(const STL_String_view *self, const char *str); /* Find characters in the view ignoring case */
+size_t STL_String_view_ifind_n(const STL_String_view *self, const char *str,
+                               size_t count); /* Find "count" characters at "str" in the view ignoring case */
+
+/* Numeric conversions. "nparsed", if not NULL, receives the number of characters used */
+int STL_String_view_parse_llong(const STL_String_view *self, long long *value,
+                                size_t *nparsed); /* Parses a decimal integer at the start of the view. Returns STL_String_OK if OK */
+int STL_String_view_parse_ullong(const STL_String_view *self, unsigned long long *value,
+                                 size_t *nparsed); /* Parses an unsigned decimal integer at the start of the view. Returns STL_String_OK if OK */
+int STL_String_view_parse_double(const STL_String_view *self, double *value,
+                                 size_t *nparsed); /* Parses a correctly rounded double at the start of the view. Returns STL_String_OK if OK */
+
+/* Hashing */
+uint64_t STL_String_view_hash(const STL_String_view *self, uint64_t seed); /* Returns the 64-bit hash of the view */
+int STL_String_view_equal(const STL_String_view *self, const STL_String_view *other); /* Checks if two views hold the same characters */
+
+/* Unicode */
+int STL_String_view_utf8_validate(const STL_String_view *self); /* Returns STL_String_OK if the view is valid UTF-8 */
+size_t STL_String_view_utf8_length(const STL_String_view *self); /* Returns the number of code points in a valid UTF-8 view */
+
+#endif
@@ -0,0 +1,108 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC_STL_UNROLLED_LIST_H
+#define SRC_STL_UNROLLED_LIST_H
+
+#include <stddef.h>
+
+/* Definition of STL_Unrolled_list_node: up to "node_capacity" elements, packed at the front of the data */
+typedef struct __STL_Unrolled_list_node {
+    struct __STL_Unrolled_list_node *next;
+    struct __STL_Unrolled_list_node *prev;
+    size_t nelem;
+} STL_Unrolled_list_node;
+
+/* Definition of STL_Unrolled_list: a doubly-linked list of small arrays of elements of one size */
+typedef struct __STL_Unrolled_list {
+    STL_Unrolled_list_node *head;
+    STL_Unrolled_list_node *tail;
+
+    size_t nbytes;
+    size_t nelem;
+    size_t node_capacity; /* Every node but the last one is kept at least half full */
+} STL_Unrolled_list;
+
+/* Definition of STL_Unrolled_list_iterator. The end iterator has a NULL "node" */
+typedef struct __STL_Unrolled_list_iterator {
+    STL_Unrolled_list_node *node;
+    size_t index;
+} STL_Unrolled_list_iterator;
+
+/* STL_Unrolled_list errors */
+enum STL_Unrolled_list_errors {
+    STL_Unrolled_list_OK = 1,                /* Everything is OK. Not an error */
+    STL_Unrolled_list_memory_error,          /* If STL_Unrolled_list routine can't allocate memory */
+    STL_Unrolled_list_index_error,           /* If desired position is wrong */
+    STL_Unrolled_list_null_reference_error   /* If (STL_Unrolled_list *) or (const void *elem) is NULL */
+};
+
+/* STL_Unrolled_list states */
+enum STL_Unrolled_list_states {
+    unrolled_list_not_empty = 0,
+    unrolled_list_is_empty
+};
+
+/* STL_Unrolled_list methods */
+/* Construction and destruction */
+int STL_Unrolled_list_init(STL_Unrolled_list *self, size_t nbytes,
+                           size_t node_capacity); /* Constructs the list for the values of size nbytes, "node_capacity" of them per node, a default one if 0. Returns STL_Unrolled_list_OK if OK */
+int STL_Unrolled_list_init_cpy(STL_Unrolled_list *self,
+                               STL_Unrolled_list *other); /* Copies the list. Returns STL_Unrolled_list_OK if OK */
+void STL_Unrolled_list_delete(STL_Unrolled_list *self); /* Destructs the list */
+
+/* Element access */
+void *STL_Unrolled_list_at(STL_Unrolled_list *self, size_t pos); /* Accesses specified element with bounds checking */
+void *STL_Unrolled_list_front(STL_Unrolled_list *self); /* Accesses the first element */
+void *STL_Unrolled_list_back(STL_Unrolled_list *self); /* Accesses the last element */
+void *STL_Unrolled_list_node_data(const STL_Unrolled_list_node *node); /* Direct access to the "nelem" elements of a node */
+
+/* Kinda iterators */
+STL_Unrolled_list_iterator STL_Unrolled_list_begin(STL_Unrolled_list *self); /* Returns iterator to the beginning */
+STL_Unrolled_list_iterator STL_Unrolled_list_end(STL_Unrolled_list *self); /* Returns iterator to the end */
+STL_Unrolled_list_iterator STL_Unrolled_list_iterator_at(STL_Unrolled_list *self,
+                                                         size_t pos); /* Returns iterator to the element at "pos", the end one if too big */
+void *STL_Unrolled_list_get(STL_Unrolled_list *self,
+                            STL_Unrolled_list_iterator iter); /* Accesses the element at "iter", NULL at the end */
+void STL_Unrolled_list_next(STL_Unrolled_list_iterator *iter); /* Moves "iter" to the next element */
+void STL_Unrolled_list_prev(STL_Unrolled_list *self,
+                            STL_Unrolled_list_iterator *iter); /* Moves "iter" to the previous element */
+
+/* Capacity */
+int STL_Unrolled_list_empty(STL_Unrolled_list *self); /* Checks whether the container is empty */
+size_t STL_Unrolled_list_size(STL_Unrolled_list *self); /* Returns the number of elements */
+
+/* Modifiers */
+void STL_Unrolled_list_clear(STL_Unrolled_list *self); /* Clears the contents */
+
+int STL_Unrolled_list_insert(STL_Unrolled_list *self, STL_Unrolled_list_iterator *pos,
+                             const void *elem); /* Inserts elem before "pos", then points "pos" to it. Returns STL_Unrolled_list_OK if OK */
+int STL_Unrolled_list_erase(STL_Unrolled_list *self,
+                            STL_Unrolled_list_iterator *pos); /* Erases element at "pos", then points "pos" to the one following it. Returns STL_Unrolled_list_OK if OK */
+
+int STL_Unrolled_list_push_back(STL_Unrolled_list *self, const void *elem); /* Adds element to the end. Returns STL_Unrolled_list_OK if OK */
+void STL_Unrolled_list_pop_back(STL_Unrolled_list *self); /* Removes the last element */
+int STL_Unrolled_list_push_front(STL_Unrolled_list *self,
+                                 const void *elem); /* Adds element to the beginning. Returns STL_Unrolled_list_OK if OK */
+void STL_Unrolled_list_pop_front(STL_Unrolled_list *self); /* Removes the first element */
+
+void STL_Unrolled_list_swap(STL_Unrolled_list *self, STL_Unrolled_list *other); /* Swaps the contents */
+
+#endif
@@ -21,6 +21,8 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 #ifndef SRC___STL_BASIC_STRING_H
 #define SRC___STL_BASIC_STRING_H
 
+#include <stdint.h>
+
 /* Definition of STL_Basic_string */
 typedef struct __STL_Basic_string {
     void *data;
@@ -28,6 +30,9 @@ typedef struct __STL_Basic_string {
     size_t nchar;
     size_t charWidth;
     size_t max_nchar;
+
+    uint64_t hash; /* Cached STL_String_hash() value, 0 until computed */
+    size_t *refs;  /* Reference count in front of a shared buffer, NULL while the buffer is private */
 } STL_Basic_string;
 
 #endif
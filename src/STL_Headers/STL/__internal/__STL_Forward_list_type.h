@@ -21,9 +21,14 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 #ifndef SRC___STL_FORWARD_LIST_TYPE_H
 #define SRC___STL_FORWARD_LIST_TYPE_H
 
+#include <stddef.h>
+
+/* Include node allocator definition */
+#include "__STL_Pool.h"
+
 /* Definition of STL_Forward_list type */
 typedef struct __STL_Forward_list_node {
-    void *value;
+    void *value; /* Points right past the node header, where the element is stored. NULL in the head and end nodes */
     size_t size;
     struct __STL_Forward_list_node *next;
 } STL_Forward_list_node;
@@ -32,6 +37,8 @@ typedef struct __STL_Forward_list {
     STL_Forward_list_node *bp;
     STL_Forward_list_node *lp;
     size_t size;
+
+    __STL_Pool pool; /* Nodes and values of this list */
 } STL_Forward_list;
 
 #endif
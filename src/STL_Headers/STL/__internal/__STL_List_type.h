@@ -21,9 +21,15 @@ along with STL. If not, see <https://www.gnu.org/licenses/>.
 #ifndef SRC___STL_LIST_TYPE_H
 #define SRC___STL_LIST_TYPE_H
 
+#include <stddef.h>
+
+/* Include node allocator and positional index definitions */
+#include "__STL_Pool.h"
+#include "__STL_Rank_tree.h"
+
 /* Definition of STL_List type */
 typedef struct __STL_List_node {
-    void *value;
+    void *value; /* Points right past the node header, where the element is stored. NULL in the end node */
     size_t size;
     struct __STL_List_node *next;
     struct __STL_List_node *prev;
@@ -33,6 +39,9 @@ typedef struct __STL_List {
     STL_List_node *bp;
     STL_List_node *lp;
     size_t size;
+
+    __STL_Pool pool;        /* Nodes and values of this list */
+    __STL_Rank_tree *index; /* Nodes by position, NULL unless enabled */
 } STL_List;
 
 #endif
@@ -0,0 +1,85 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC___STL_POOL_H
+#define SRC___STL_POOL_H
+
+#include <stddef.h>
+
+/* Number of block size classes, 16 to 512 bytes */
+#define __STL_POOL_NCLASSES 10
+
+/* Definition of __STL_Pool_slab: header of every chunk of a slab. Chunks are aligned to their size, so a block finds it.
+ * Small slabs of all pools share chunks, each with a header of its own */
+typedef struct __STL_Pool_slab {
+    struct __STL_Pool_slab *head;  /* First chunk of the slab. Only its header has the fields below. NULL in a shared chunk */
+    struct __STL_Pool_slab *next;  /* Next slab of the pool that allocated it */
+    struct __STL_Pool_home *home;  /* Home of that pool if it is shared. NULL once the pool is released */
+    size_t live;                   /* Blocks cut out of the slab and not dropped yet. In a shared chunk, slabs not freed yet */
+} __STL_Pool_slab;
+
+/* Definition of __STL_Pool_home: where blocks of a shared pool go back to when another pool frees them */
+typedef struct __STL_Pool_home {
+    void *returned[__STL_POOL_NCLASSES]; /* Blocks given back, linked through their first word */
+} __STL_Pool_home;
+
+/* Definition of __STL_Pool_class: blocks of one size, carved out of slabs */
+typedef struct __STL_Pool_class {
+    void *free;     /* Spare blocks, linked through their first word */
+    void *last;     /* Last spare block, so that free lists are joined at once */
+    size_t nfree;   /* Number of spare blocks */
+    size_t nblocks; /* Blocks in the newest slab. Every slab is twice the previous one, up to a chunk */
+} __STL_Pool_class;
+
+/* Definition of __STL_Pool: node and value allocator owned by one container */
+typedef struct __STL_Pool {
+    __STL_Pool_slab *slabs; /* Own slabs of all classes */
+    size_t nlarge;          /* Blocks above 512 bytes. They come from malloc() one by one */
+    __STL_Pool_home *home;  /* Set once blocks may move to or from other pools, NULL before */
+    char *cursor;           /* Next block of the newest run, see __STL_Pool_run() */
+    char *limit;            /* End of the chunk the cursor is in */
+    __STL_Pool_class classes[__STL_POOL_NCLASSES];
+} __STL_Pool;
+
+/* __STL_Pool methods. Not a part of the public interface */
+void __STL_Pool_init(__STL_Pool *pool); /* Constructs an empty pool. Never allocates */
+void *__STL_Pool_alloc(__STL_Pool *pool, size_t size); /* Returns a 16-byte aligned block of "size" bytes, NULL on failure */
+void __STL_Pool_free(__STL_Pool *pool, void *block, size_t size); /* Gives back a block allocated with the same "size" */
+int __STL_Pool_reserve(__STL_Pool *pool, size_t size,
+                       size_t count); /* Makes "count" blocks of "size" bytes available without allocation. Returns 1 if OK */
+void __STL_Pool_release(
+    __STL_Pool *pool); /* Frees all slabs no other pool has blocks in. Large blocks, and all blocks of a shared pool, must have been freed before */
+void __STL_Pool_adopt(__STL_Pool *pool,
+                      __STL_Pool *other); /* Takes over all blocks of "other", so they can move between containers */
+int __STL_Pool_share(__STL_Pool *pool,
+                     __STL_Pool *other); /* Lets single blocks move between both pools from now on. Returns 1 if OK */
+void __STL_Pool_move(__STL_Pool *pool, __STL_Pool *other,
+                     size_t size); /* Accounts for a block of "size" bytes of "other" that is now freed by "pool" */
+
+/* Layout */
+size_t __STL_Pool_block_size(size_t size); /* Returns the bytes a block of "size" bytes takes in a slab, 0 if it comes from malloc() */
+int __STL_Pool_adjacent(const void *block, size_t size,
+                        const void *next); /* Returns 1 if "next" is the block laid out right after "block" of "size" bytes */
+int __STL_Pool_run(__STL_Pool *pool,
+                   size_t nbytes); /* Adds a slab for blocks of __STL_Pool_block_size() bytes, "nbytes" in total. Returns 1 if OK */
+void *__STL_Pool_run_alloc(__STL_Pool *pool,
+                           size_t size); /* Returns the next block of the newest run, in address order. It must have room */
+
+#endif
@@ -0,0 +1,46 @@
+/*
+Standard Template Library for C — free shared library, that contains an attempt of recreation of libc++ STL
+Copyright © Pavlovsky Anton, 2019-2022
+
+This file is part of STL.
+
+STL is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+STL is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with STL. If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef SRC___STL_RANK_TREE_H
+#define SRC___STL_RANK_TREE_H
+
+#include <stddef.h>
+
+/* Definition of __STL_Rank_tree: a B-tree of items, where every child is counted, to find an item by its position */
+typedef struct __STL_Rank_tree {
+    struct __STL_Rank_tree_node *root;
+    struct __STL_Rank_tree_node *spare; /* Nodes put aside for splits, so that insertion can't fail halfway */
+    size_t nspare;
+    size_t height;
+    size_t size;
+    int stale; /* Set by the owner when the items no longer match it. The tree has to be rebuilt then */
+} __STL_Rank_tree;
+
+/* __STL_Rank_tree methods. Not a part of the public interface */
+void __STL_Rank_tree_init(__STL_Rank_tree *tree); /* Constructs an empty tree. Never allocates */
+void __STL_Rank_tree_clear(__STL_Rank_tree *tree); /* Frees all nodes */
+int __STL_Rank_tree_build(__STL_Rank_tree *tree, void **items,
+                          size_t n); /* Replaces the contents with "n" items, in order, in O(n). Returns 1 if OK */
+void *__STL_Rank_tree_at(const __STL_Rank_tree *tree, size_t rank); /* Returns the item at "rank", NULL if too big */
+int __STL_Rank_tree_insert(__STL_Rank_tree *tree, size_t rank,
+                           void *item); /* Inserts "item" so that it gets "rank". Returns 1 if OK */
+void *__STL_Rank_tree_erase(__STL_Rank_tree *tree, size_t rank); /* Removes the item at "rank". Returns it, NULL if too big */
+
+#endif
@@ -0,0 +1,132 @@
+#include <pthread.h>
+#include <stdio.h>
+
+#include "../src/STL_Headers/STL/STL_Concurrent_forward_list.h"
+
+#define NTHREADS 4
+#define NKEYS 256
+#define NOPS 200000
+
+static int failed = 0;
+
+static STL_Concurrent_forward_list list;
+static size_t inserted = 0, erased = 0, mismatches = 0;
+
+void check(int cond, const char *what) {
+
+    /* Main part */
+    printf("%s\t%s\n", cond ? "OK!" : "FAIL!", what);
+    if (!cond) {
+        ++failed;
+    }
+}
+
+int longcmp(const void *a, const void *b) {
+
+    /* Initializing variables */
+    auto long x = *(const long *) a, y = *(const long *) b;
+
+    /* Returning value */
+    return (x > y) - (x < y);
+}
+
+void *worker(void *arg) {
+
+    /* Every thread owns the keys equal to its number modulo NTHREADS and knows which of them are in.
+     * Negative keys are fought over by all threads */
+
+    /* Initializing variables */
+    auto long id = (long) arg, key;
+    auto unsigned seed = (unsigned) id * 7919 + 1;
+    auto STL_Concurrent_forward_list_thread *thread = STL_Concurrent_forward_list_attach(&list);
+    auto char in[NKEYS] = {0};
+    auto size_t i, nins = 0, nerase = 0, nbad = 0;
+    auto int code;
+
+    /* Main part */
+    for (i = 0; i < NOPS && thread != NULL; ++i) {
+        seed = seed * 1103515245 + 12345;
+        key = (long) ((seed >> 8) % NKEYS);
+
+        if ((seed >> 4) % 4 == 0) {
+            key = -1 - key;
+            if ((seed >> 20) % 2) {
+                nins += STL_Concurrent_forward_list_insert(&list, thread, &key) == STL_Concurrent_forward_list_OK;
+            } else {
+                nerase += STL_Concurrent_forward_list_erase(&list, thread, &key) == STL_Concurrent_forward_list_OK;
+            }
+            continue;
+        }
+
+        key = key * NTHREADS + id;
+        switch ((seed >> 12) % 3) {
+            case 0:
+                code = STL_Concurrent_forward_list_insert(&list, thread, &key);
+                nbad += (code == STL_Concurrent_forward_list_OK) == in[key / NTHREADS];
+                nins += code == STL_Concurrent_forward_list_OK;
+                in[key / NTHREADS] = 1;
+                break;
+            case 1:
+                code = STL_Concurrent_forward_list_erase(&list, thread, &key);
+                nbad += (code == STL_Concurrent_forward_list_OK) != in[key / NTHREADS];
+                nerase += code == STL_Concurrent_forward_list_OK;
+                in[key / NTHREADS] = 0;
+                break;
+            default:
+                nbad += STL_Concurrent_forward_list_contains(&list, thread, &key) != in[key / NTHREADS];
+                break;
+        }
+    }
+
+    if (thread != NULL) {
+        STL_Concurrent_forward_list_detach(&list, thread);
+    } else {
+        ++nbad;
+    }
+
+    __atomic_add_fetch(&inserted, nins, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&erased, nerase, __ATOMIC_RELAXED);
+    __atomic_add_fetch(&mismatches, nbad, __ATOMIC_RELAXED);
+
+    /* Returning value */
+    return NULL;
+}
+
+main() {
+
+    /* Initializing variables */
+    auto pthread_t threads[NTHREADS];
+    auto STL_Concurrent_forward_list_node *iter;
+    auto long i, prev = 0;
+    auto size_t n = 0;
+    auto int sorted = 1, unmarked = 1;
+
+    STL_Concurrent_forward_list_init(&list, sizeof(long), longcmp);
+
+    /* Main part */
+    for (i = 0; i < NTHREADS; ++i) {
+        pthread_create(threads + i, NULL, worker, (void *) i);
+    }
+    for (i = 0; i < NTHREADS; ++i) {
+        pthread_join(threads[i], NULL);
+    }
+    check(mismatches == 0, "insert, erase and contains agree with each thread's own keys");
+
+    /* The element follows its node, 16-byte aligned */
+    for (iter = list.head; iter != NULL; iter = iter->next, ++n) {
+        unmarked = unmarked && !((size_t) iter->next & 1);
+        sorted = sorted && (n == 0 || *(long *) ((char *) iter + 16) > prev);
+        prev = *(long *) ((char *) iter + 16);
+        if (!unmarked) {
+            break;
+        }
+    }
+    check(sorted, "elements in ascending order");
+    check(unmarked, "no marked links left");
+    check(n == STL_Concurrent_forward_list_size(&list) && n == inserted - erased, "size == inserts - erases");
+
+    STL_Concurrent_forward_list_delete(&list);
+
+    /* Returning value */
+    return failed;
+}
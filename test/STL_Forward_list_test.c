@@ -0,0 +1,227 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/STL_Headers/STL/STL_Forward_list.h"
+
+#define N 2000
+#define BIG 600
+#define NKEYS 50
+
+typedef struct record {
+    int key;
+    int order;
+} record;
+
+static int failed = 0;
+
+void check(int cond, const char *what) {
+
+    /* Main part */
+    printf("%s\t%s\n", cond ? "OK!" : "FAIL!", what);
+    if (!cond) {
+        ++failed;
+    }
+}
+
+int intcmp(const void *a, const void *b) {
+
+    /* Returning value */
+    return *(const int *) a - *(const int *) b;
+}
+
+int keycmp(const void *a, const void *b) {
+
+    /* Returning value */
+    return ((const record *) a)->key - ((const record *) b)->key;
+}
+
+void fill(STL_Forward_list *l, int first, int n) {
+
+    /* Appends "n" records with random keys, numbered in order from "first" */
+
+    /* Initializing variables */
+    auto STL_Forward_list_node *tail;
+    auto record rec;
+    auto int i;
+
+    /* Main part */
+    for (tail = STL_Forward_list_before_begin(l); tail->next != STL_Forward_list_end(l); tail = tail->next)
+        ;
+    for (i = 0; i < n; ++i, tail = tail->next) {
+        rec.key = rand() % NKEYS;
+        rec.order = first + i;
+        STL_Forward_list_insert_after(l, &rec, sizeof(record), tail);
+    }
+}
+
+int stable(STL_Forward_list *l, size_t n) {
+
+    /* Keys of the first "n" records go up, and equal keys keep the order the records were made in */
+
+    /* Initializing variables */
+    auto STL_Forward_list_node *iter;
+    auto record *a, *b;
+
+    /* Main part */
+    for (iter = STL_Forward_list_begin(l); n > 1; iter = iter->next, --n) {
+        if (iter->next == STL_Forward_list_end(l)) {
+            return 0;
+        }
+
+        a = iter->value;
+        b = iter->next->value;
+        if (a->key > b->key || (a->key == b->key && a->order > b->order)) {
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return 1;
+}
+
+int holds(const void *elem, size_t size, int value) {
+
+    /* A large element is "value" followed by bytes equal to it */
+
+    /* Initializing variables */
+    auto const char *bytes = elem;
+    auto size_t i;
+
+    /* Main part */
+    if (*(const int *) elem != value) {
+        return 0;
+    }
+
+    for (i = sizeof(int); i < size; ++i) {
+        if (bytes[i] != (char) value) {
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return 1;
+}
+
+main() {
+
+    /* Initializing variables */
+    auto STL_Forward_list list, other, donor;
+    auto STL_Forward_list_node *iter, *tail;
+    auto record *rec;
+    auto int i, ok;
+    auto size_t n, nlarge;
+    static int model[N];
+    static STL_Forward_list_node *large[N];
+    static char big[BIG];
+
+    STL_Forward_list_init(&list);
+    srand(1);
+
+    /* Main part */
+    /* Sorting relinks nodes all over their slabs, compacting lays them out again. Every 50th element is large */
+    for (i = 0, tail = STL_Forward_list_before_begin(&list); i < N; ++i, tail = tail->next) {
+        model[i] = rand() % 1000;
+        if (i % 50 == 0) {
+            memset(big, (char) model[i], BIG);
+            memcpy(big, model + i, sizeof(int));
+            STL_Forward_list_insert_after(&list, big, BIG, tail);
+        } else {
+            STL_Forward_list_insert_after(&list, model + i, sizeof(int), tail);
+        }
+    }
+    STL_Forward_list_sort(&list, -1, intcmp);
+    qsort(model, N, sizeof(int), intcmp);
+
+    for (nlarge = 0, iter = STL_Forward_list_begin(&list); iter != STL_Forward_list_end(&list); iter = iter->next) {
+        if (iter->size == BIG) {
+            large[nlarge++] = iter;
+        }
+    }
+    check(nlarge == N / 50 && STL_Forward_list_fragmentation(&list) > 0.5, "sorted nodes are scattered");
+
+    check(STL_Forward_list_compact(&list) == STL_Forward_list_OK && STL_Forward_list_fragmentation(&list) == 0.0,
+          "compact leaves no gaps");
+
+    for (ok = 1, n = 0, i = 0, iter = STL_Forward_list_begin(&list); iter != STL_Forward_list_end(&list);
+         iter = iter->next, ++i) {
+        ok = ok && i < N && holds(iter->value, iter->size, model[i]);
+        if (iter->size == BIG) {
+            ok = ok && n < nlarge && iter == large[n++];
+        }
+    }
+    check(ok && i == N && STL_Forward_list_size(&list) == N, "compact keeps contents and order");
+    check(ok && n == nlarge, "large nodes survive compact where they are");
+
+    /* The compacted nodes go back to the pool like any others */
+    for (i = 0; i < N / 2; ++i) {
+        STL_Forward_list_pop_front(&list);
+        STL_Forward_list_push_front(&list, &i, sizeof(int));
+        STL_Forward_list_erase_after(&list, STL_Forward_list_begin(&list));
+    }
+    check(STL_Forward_list_size(&list) == N / 2 && *(int *) STL_Forward_list_front(&list) == N / 2 - 1,
+          "compacted nodes freed and reused");
+
+    STL_Forward_list_delete(&list);
+
+    /* Equal keys keep their order */
+    STL_Forward_list_init(&list);
+    STL_Forward_list_init(&other);
+    STL_Forward_list_init(&donor);
+
+    fill(&list, 0, N);
+    STL_Forward_list_sort(&list, -1, keycmp);
+    check(STL_Forward_list_size(&list) == N && stable(&list, N), "sort is stable");
+
+    fill(&other, N, N);
+    STL_Forward_list_sort(&other, N / 2, keycmp);
+    for (ok = 1, i = 0, iter = STL_Forward_list_begin(&other); i < N; ++i, iter = iter->next) {
+        rec = iter->value;
+        ok = ok && (i < N / 2 || rec->order == N + i);
+    }
+    check(ok && stable(&other, N / 2), "sort of the first elements leaves the rest");
+    STL_Forward_list_clear(&other);
+
+    /* Records of "list" go first among equal keys */
+    fill(&other, N, N);
+    STL_Forward_list_sort(&other, -1, keycmp);
+    STL_Forward_list_merge(&list, &other, keycmp);
+    check(STL_Forward_list_size(&list) == 2 * N && stable(&list, 2 * N) && STL_Forward_list_empty(&other),
+          "merge of sorted lists is stable");
+
+    STL_Forward_list_merge(&list, &other, keycmp);
+    check(STL_Forward_list_size(&list) == 2 * N && stable(&list, 2 * N), "merge of an empty list");
+
+    STL_Forward_list_merge(&other, &list, keycmp);
+    check(STL_Forward_list_size(&other) == 2 * N && stable(&other, 2 * N) && STL_Forward_list_empty(&list),
+          "merge into an empty list");
+
+    /* Every other node of "donor" is spliced over. They stay in the slabs of "donor", which outlive it */
+    fill(&donor, 2 * N, N);
+    STL_Forward_list_sort(&donor, -1, keycmp);
+    for (tail = STL_Forward_list_before_begin(&list), iter = STL_Forward_list_before_begin(&donor);
+         iter->next != STL_Forward_list_end(&donor); tail = tail->next) {
+        STL_Forward_list_splice_after_node(&list, tail, &donor, iter);
+        if (iter->next != STL_Forward_list_end(&donor)) {
+            iter = iter->next;
+        }
+    }
+    n = STL_Forward_list_size(&list);
+    STL_Forward_list_delete(&donor);
+
+    STL_Forward_list_merge(&other, &list, keycmp);
+    STL_Forward_list_delete(&list);
+    check(n == N / 2 && STL_Forward_list_size(&other) == 2 * N + n && stable(&other, 2 * N + n),
+          "merge of nodes from another pool");
+
+    while (!STL_Forward_list_empty(&other)) {
+        STL_Forward_list_pop_front(&other);
+    }
+    fill(&other, 0, N);
+    check(STL_Forward_list_size(&other) == N, "merged nodes freed");
+
+    STL_Forward_list_delete(&other);
+
+    /* Returning value */
+    return failed;
+}
@@ -0,0 +1,174 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../src/STL_Headers/STL/STL_Index_list.h"
+
+#define N 3000
+
+static int failed = 0;
+
+void check(int cond, const char *what) {
+
+    /* Main part */
+    printf("%s\t%s\n", cond ? "OK!" : "FAIL!", what);
+    if (!cond) {
+        ++failed;
+    }
+}
+
+int matches(STL_Index_list *l, const uint32_t *slots, const int *model, size_t n) {
+
+    /* Every element is still in the slot it was inserted in */
+
+    /* Initializing variables */
+    auto uint32_t pos;
+    auto size_t i;
+
+    /* Main part */
+    if (STL_Index_list_size(l) != n) {
+        return 0;
+    }
+
+    for (i = 0, pos = STL_Index_list_begin(l); pos != STL_Index_list_end(l); pos = STL_Index_list_next(l, pos), ++i) {
+        if (i == n || pos != slots[i] || *(int *) STL_Index_list_get(l, pos) != model[i]) {
+            return 0;
+        }
+    }
+
+    for (pos = STL_Index_list_prev(l, STL_Index_list_end(l)); i > 0; pos = STL_Index_list_prev(l, pos)) {
+        if (pos != slots[--i]) {
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return pos == STL_Index_list_end(l);
+}
+
+STL_Index_list_links *links_at(char *data, STL_Index_list *l, uint32_t slot) {
+
+    /* Returning value */
+    return (STL_Index_list_links *) (data + slot * l->stride);
+}
+
+main() {
+
+    /* Initializing variables */
+    auto STL_Index_list list, copy;
+    auto uint32_t pos, a, b, c, d;
+    auto int i, ok = 1, value = 0;
+    auto size_t n = 0, at, j, size;
+    auto char *data;
+    static int model[N];
+    static uint32_t slots[N];
+
+    STL_Index_list_init(&list, sizeof(int));
+    srand(1);
+
+    /* Main part */
+    /* Random inserts and erases by slot, checked against an array */
+    for (i = 0; i < 20000; ++i) {
+        if (n < N && (n == 0 || rand() % 100 < 55)) {
+            at = (size_t) rand() % (n + 1);
+            pos = (at == n) ? STL_Index_list_end(&list) : slots[at];
+            ok = ok && STL_Index_list_insert(&list, &pos, &value) == STL_Index_list_OK &&
+                 *(int *) STL_Index_list_get(&list, pos) == value;
+            for (j = n; j > at; --j) {
+                model[j] = model[j - 1];
+                slots[j] = slots[j - 1];
+            }
+            model[at] = value++;
+            slots[at] = pos;
+            ++n;
+        } else {
+            at = (size_t) rand() % n;
+            pos = slots[at];
+            ok = ok && STL_Index_list_erase(&list, &pos) == STL_Index_list_OK &&
+                 pos == ((at + 1 == n) ? STL_Index_list_end(&list) : slots[at + 1]);
+            for (j = at; j + 1 < n; ++j) {
+                model[j] = model[j + 1];
+                slots[j] = slots[j + 1];
+            }
+            --n;
+        }
+        if (i % 100 == 0) {
+            ok = ok && matches(&list, slots, model, n);
+        }
+    }
+    check(ok && matches(&list, slots, model, n), "insert + erase by slot");
+
+    /* The slots saved as they are make the same list, with the same slot numbers and the unused slots reusable */
+    size = STL_Index_list_data_size(&list);
+    data = malloc(size);
+    memcpy(data, STL_Index_list_data(&list), size);
+    check(STL_Index_list_init_data(&copy, sizeof(int), data, size) == STL_Index_list_OK &&
+              matches(&copy, slots, model, n) && STL_Index_list_capacity(&copy) == STL_Index_list_capacity(&list),
+          "data + init_data round trip");
+
+    for (ok = 1; n < N; ++n) {
+        ok = ok && STL_Index_list_push_back(&copy, &value) == STL_Index_list_OK;
+        model[n] = value++;
+        slots[n] = STL_Index_list_prev(&copy, STL_Index_list_end(&copy));
+    }
+    check(ok && matches(&copy, slots, model, n), "init_data keeps the unused slots");
+    STL_Index_list_delete(&copy);
+
+    check(STL_Index_list_init_data(&copy, sizeof(int), NULL, 0) == STL_Index_list_OK && STL_Index_list_empty(&copy),
+          "init_data of no data");
+    STL_Index_list_delete(&copy);
+
+    STL_Index_list_clear(&list);
+    check(STL_Index_list_init_data(&copy, sizeof(int), STL_Index_list_data(&list), STL_Index_list_data_size(&list)) ==
+                  STL_Index_list_OK &&
+              STL_Index_list_empty(&copy),
+          "init_data of a cleared list");
+    STL_Index_list_delete(&copy);
+
+    check(STL_Index_list_init_data(&copy, sizeof(int), data, size - 1) == STL_Index_list_index_error,
+          "init_data of a cut slot");
+
+    /* Corrupted links are refused, and leave an empty list behind */
+    STL_Index_list_delete(&list);
+    for (i = 0; i < 4; ++i) {
+        STL_Index_list_push_back(&list, &i);
+    }
+    a = STL_Index_list_begin(&list);
+    b = STL_Index_list_next(&list, a);
+    c = STL_Index_list_next(&list, b);
+    d = STL_Index_list_next(&list, c);
+    size = STL_Index_list_data_size(&list);
+
+    memcpy(data, STL_Index_list_data(&list), size);
+    links_at(data, &list, b)->next = (uint32_t) STL_Index_list_capacity(&list) + 5;
+    check(STL_Index_list_init_data(&copy, sizeof(int), data, size) == STL_Index_list_index_error &&
+              STL_Index_list_empty(&copy) && STL_Index_list_data(&copy) == NULL,
+          "init_data refuses a link out of range");
+
+    memcpy(data, STL_Index_list_data(&list), size);
+    links_at(data, &list, c)->prev = a;
+    check(STL_Index_list_init_data(&copy, sizeof(int), data, size) == STL_Index_list_index_error,
+          "init_data refuses a link not pointing back");
+
+    /* a and the end slot make one ring, b, c and d another one: every link is answered, but three slots are cut off */
+    memcpy(data, STL_Index_list_data(&list), size);
+    links_at(data, &list, a)->next = STL_Index_list_end(&list);
+    links_at(data, &list, STL_Index_list_end(&list))->prev = a;
+    links_at(data, &list, d)->next = b;
+    links_at(data, &list, b)->prev = d;
+    check(STL_Index_list_init_data(&copy, sizeof(int), data, size) == STL_Index_list_index_error &&
+              STL_Index_list_empty(&copy),
+          "init_data refuses slots out of the chain");
+
+    memcpy(data, STL_Index_list_data(&list), size);
+    check(STL_Index_list_init_data(&copy, sizeof(int), data, size) == STL_Index_list_OK &&
+              *(int *) STL_Index_list_get(&copy, d) == 3 && STL_Index_list_size(&copy) == 4,
+          "init_data of the same slots untouched");
+
+    free(data);
+    STL_Index_list_delete(&copy);
+    STL_Index_list_delete(&list);
+
+    /* Returning value */
+    return failed;
+}
@@ -0,0 +1,148 @@
+#include <stdio.h>
+
+#include "../src/STL_Headers/STL/STL_Intrusive_forward_list.h"
+
+#define N 10
+
+typedef struct item {
+    int key;
+    int order;
+    STL_Intrusive_forward_list_hook hook;
+} item;
+
+static int failed = 0;
+
+void check(int cond, const char *what) {
+
+    /* Main part */
+    printf("%s\t%s\n", cond ? "OK!" : "FAIL!", what);
+    if (!cond) {
+        ++failed;
+    }
+}
+
+int keycmp(const STL_Intrusive_forward_list_hook *a, const STL_Intrusive_forward_list_hook *b) {
+
+    /* Returning value */
+    return STL_Intrusive_forward_list_entry(a, item, hook)->key - STL_Intrusive_forward_list_entry(b, item, hook)->key;
+}
+
+int keys_are(STL_Intrusive_forward_list *l, const int *keys, size_t n) {
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list_hook *iter;
+    auto size_t i;
+
+    /* Main part */
+    if (STL_Intrusive_forward_list_size(l) != n) {
+        return 0;
+    }
+
+    for (i = 0, iter = STL_Intrusive_forward_list_begin(l); iter != STL_Intrusive_forward_list_end(l);
+         iter = iter->next, ++i) {
+        if (i == n || STL_Intrusive_forward_list_entry(iter, item, hook)->key != keys[i]) {
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return i == n;
+}
+
+main() {
+
+    /* Initializing variables */
+    auto STL_Intrusive_forward_list a, b;
+    auto STL_Intrusive_forward_list_hook *hook;
+    auto item items[N], more[N];
+    auto int i, ok, model[N];
+    static const int pushed[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    static const int edited[] = {1, 10, 2, 3, 4, 5, 6, 7, 8, 9};
+    static const int spliced[] = {1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 2, 3, 4, 5, 6, 7, 8, 9};
+    static const int moved[] = {1, 10, 14, 15, 16, 17, 18, 19, 2, 3, 4, 5, 6, 7, 8, 9};
+    static const int sorted[] = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4};
+
+    STL_Intrusive_forward_list_init(&a);
+    STL_Intrusive_forward_list_init(&b);
+    for (i = 0; i < N; ++i) {
+        items[i].key = i;
+        more[i].key = N + i;
+    }
+
+    /* Main part */
+    check(STL_Intrusive_forward_list_empty(&a) && STL_Intrusive_forward_list_front(&a) == NULL, "empty after init");
+
+    for (i = N - 1; i >= 0; --i) {
+        STL_Intrusive_forward_list_push_front(&a, &items[i].hook);
+    }
+    check(keys_are(&a, pushed, N), "push_front");
+
+    hook = STL_Intrusive_forward_list_pop_front(&a);
+    check(hook == &items[0].hook && hook->next == NULL && keys_are(&a, pushed + 1, N - 1),
+          "pop_front unlinks the first hook");
+
+    /* The popped hook comes back after "1", with another key */
+    items[0].key = 10;
+    STL_Intrusive_forward_list_insert_after(&a, &items[1].hook, &items[0].hook);
+    check(keys_are(&a, edited, N), "insert_after a hook");
+
+    hook = STL_Intrusive_forward_list_erase_after(&a, &items[1].hook);
+    check(hook == &items[2].hook && items[0].hook.next == NULL && keys_are(&a, pushed + 1, N - 1),
+          "erase_after unlinks the hook");
+    STL_Intrusive_forward_list_insert_after(&a, &items[1].hook, &items[0].hook);
+    check(STL_Intrusive_forward_list_erase_after(&a, &items[9].hook) == NULL && keys_are(&a, edited, N),
+          "erase_after the last hook is refused");
+
+    /* Splicing */
+    for (i = N - 1; i > 0; --i) {
+        STL_Intrusive_forward_list_push_front(&b, &more[i].hook);
+    }
+    STL_Intrusive_forward_list_splice_after(&a, &items[0].hook, &b);
+    check(keys_are(&a, spliced, 2 * N - 1) && STL_Intrusive_forward_list_empty(&b), "splice_after a whole list");
+
+    STL_Intrusive_forward_list_splice_after_range(&b, STL_Intrusive_forward_list_before_begin(&b), &a, &items[0].hook,
+                                                  &more[4].hook);
+    check(keys_are(&a, moved, 2 * N - 4) && STL_Intrusive_forward_list_size(&b) == 3,
+          "splice_after_range between lists");
+
+    STL_Intrusive_forward_list_splice_after_range(&a, &items[0].hook, &b, STL_Intrusive_forward_list_before_begin(&b),
+                                                  NULL);
+    check(keys_are(&a, spliced, 2 * N - 1) && STL_Intrusive_forward_list_empty(&b), "splice_after_range up to the end");
+
+    STL_Intrusive_forward_list_splice_after_hook(&b, STL_Intrusive_forward_list_before_begin(&b), &a, &items[1].hook);
+    STL_Intrusive_forward_list_splice_after_hook(&a, &items[1].hook, &b, STL_Intrusive_forward_list_before_begin(&b));
+    check(keys_are(&a, spliced, 2 * N - 1) && STL_Intrusive_forward_list_empty(&b), "splice_after_hook there and back");
+
+    /* Equal keys keep the order they had */
+    STL_Intrusive_forward_list_clear(&a);
+    for (i = N - 1; i >= 0; --i) {
+        items[i].key = (i * 7) % N / 2;
+        items[i].order = i;
+        STL_Intrusive_forward_list_push_front(&a, &items[i].hook);
+    }
+    STL_Intrusive_forward_list_sort(&a, keycmp);
+    ok = keys_are(&a, sorted, N);
+    for (hook = STL_Intrusive_forward_list_begin(&a); hook->next != NULL; hook = hook->next) {
+        ok = ok && (keycmp(hook, hook->next) < 0 || STL_Intrusive_forward_list_entry(hook, item, hook)->order <
+                                                     STL_Intrusive_forward_list_entry(hook->next, item, hook)->order);
+    }
+    check(ok, "sort is stable");
+
+    STL_Intrusive_forward_list_reverse(&a);
+    for (i = 0; i < N; ++i) {
+        model[i] = sorted[N - 1 - i];
+    }
+    check(keys_are(&a, model, N), "reverse");
+
+    STL_Intrusive_forward_list_swap(&a, &b);
+    check(STL_Intrusive_forward_list_empty(&a) && keys_are(&b, model, N), "swap");
+
+    STL_Intrusive_forward_list_clear(&b);
+    for (ok = 1, i = 0; i < N; ++i) {
+        ok = ok && items[i].hook.next == NULL;
+    }
+    check(ok && STL_Intrusive_forward_list_empty(&b), "clear unlinks every hook");
+
+    /* Returning value */
+    return failed;
+}
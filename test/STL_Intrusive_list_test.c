@@ -0,0 +1,158 @@
+#include <stdio.h>
+
+#include "../src/STL_Headers/STL/STL_Intrusive_list.h"
+
+#define N 10
+
+typedef struct item {
+    int key;
+    int order;
+    STL_Intrusive_list_hook hook;
+} item;
+
+static int failed = 0;
+
+void check(int cond, const char *what) {
+
+    /* Main part */
+    printf("%s\t%s\n", cond ? "OK!" : "FAIL!", what);
+    if (!cond) {
+        ++failed;
+    }
+}
+
+int keycmp(const STL_Intrusive_list_hook *a, const STL_Intrusive_list_hook *b) {
+
+    /* Returning value */
+    return STL_Intrusive_list_entry(a, item, hook)->key - STL_Intrusive_list_entry(b, item, hook)->key;
+}
+
+int keys_are(STL_Intrusive_list *l, const int *keys, size_t n) {
+
+    /* Walks both ways, so the "prev" links are checked too */
+
+    /* Initializing variables */
+    auto STL_Intrusive_list_hook *iter;
+    auto size_t i;
+
+    /* Main part */
+    if (STL_Intrusive_list_size(l) != n) {
+        return 0;
+    }
+
+    for (i = 0, iter = STL_Intrusive_list_begin(l); iter != STL_Intrusive_list_end(l); iter = iter->next, ++i) {
+        if (i == n || STL_Intrusive_list_entry(iter, item, hook)->key != keys[i]) {
+            return 0;
+        }
+    }
+
+    for (iter = STL_Intrusive_list_end(l)->prev; iter != STL_Intrusive_list_end(l); iter = iter->prev) {
+        if (i == 0 || STL_Intrusive_list_entry(iter, item, hook)->key != keys[--i]) {
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return i == 0;
+}
+
+main() {
+
+    /* Initializing variables */
+    auto STL_Intrusive_list a, b;
+    auto STL_Intrusive_list_hook *hook;
+    auto item items[N], more[N];
+    auto int i, ok, model[N];
+    static const int pushed[] = {3, 2, 1, 0, 4, 5, 6, 7, 8, 9};
+    static const int edited[] = {2, 1, 10, 0, 4, 5, 6, 7, 8};
+    static const int spliced[] = {2, 1, 10, 0, 4, 5, 6, 7, 8, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    static const int moved[] = {11, 12, 13, 14, 15, 16, 17, 18, 19, 2, 1, 10, 0, 4, 5, 6, 7, 8};
+    static const int sorted[] = {0, 0, 1, 1, 2, 2, 3, 3, 4, 4};
+
+    STL_Intrusive_list_init(&a);
+    STL_Intrusive_list_init(&b);
+    for (i = 0; i < N; ++i) {
+        items[i].key = i;
+        more[i].key = N + i;
+        STL_Intrusive_list_hook_init(&items[i].hook);
+        STL_Intrusive_list_hook_init(&more[i].hook);
+    }
+
+    /* Main part */
+    check(STL_Intrusive_list_empty(&a) && !STL_Intrusive_list_is_linked(&items[0].hook), "empty after init");
+
+    for (i = 4; i < N; ++i) {
+        STL_Intrusive_list_push_back(&a, &items[i].hook);
+    }
+    for (i = 0; i < 4; ++i) {
+        STL_Intrusive_list_push_front(&a, &items[i].hook);
+    }
+    check(keys_are(&a, pushed, N), "push_back + push_front");
+
+    hook = STL_Intrusive_list_pop_back(&a);
+    check(hook == &items[9].hook && !STL_Intrusive_list_is_linked(hook), "pop_back unlinks the last hook");
+    hook = STL_Intrusive_list_pop_front(&a);
+    check(hook == &items[3].hook && !STL_Intrusive_list_is_linked(hook), "pop_front unlinks the first hook");
+
+    /* The popped hook comes back in front of "0", with another key */
+    items[3].key = 10;
+    STL_Intrusive_list_insert(&a, &items[0].hook, &items[3].hook);
+    check(STL_Intrusive_list_is_linked(&items[3].hook) && keys_are(&a, edited, N - 1), "insert before a hook");
+
+    hook = STL_Intrusive_list_erase(&a, &items[3].hook);
+    check(hook == &items[0].hook && !STL_Intrusive_list_is_linked(&items[3].hook), "erase unlinks the hook");
+    STL_Intrusive_list_insert(&a, hook, &items[3].hook);
+    check(STL_Intrusive_list_erase(&a, STL_Intrusive_list_end(&a)) == NULL && keys_are(&a, edited, N - 1),
+          "erase of the end is refused");
+
+    /* Splicing */
+    for (i = 1; i < N; ++i) {
+        STL_Intrusive_list_push_back(&b, &more[i].hook);
+    }
+    STL_Intrusive_list_splice(&a, STL_Intrusive_list_end(&a), &b);
+    check(keys_are(&a, spliced, 2 * N - 2) && STL_Intrusive_list_empty(&b), "splice a whole list");
+
+    STL_Intrusive_list_splice_range(&b, STL_Intrusive_list_end(&b), &a, STL_Intrusive_list_begin(&a), &more[1].hook);
+    STL_Intrusive_list_splice(&a, STL_Intrusive_list_end(&a), &b);
+    check(keys_are(&a, moved, 2 * N - 2) && STL_Intrusive_list_empty(&b), "splice_range between lists");
+
+    STL_Intrusive_list_splice_hook(&b, STL_Intrusive_list_end(&b), &a, &items[3].hook);
+    STL_Intrusive_list_splice_hook(&a, &items[0].hook, &b, &items[3].hook);
+    check(keys_are(&a, moved, 2 * N - 2) && STL_Intrusive_list_empty(&b), "splice_hook there and back");
+
+    STL_Intrusive_list_splice_range(&a, STL_Intrusive_list_end(&a), &a, STL_Intrusive_list_begin(&a), &items[2].hook);
+    check(keys_are(&a, spliced, 2 * N - 2), "splice_range within a list");
+
+    /* Equal keys keep the order they had */
+    STL_Intrusive_list_clear(&a);
+    for (i = 0; i < N; ++i) {
+        items[i].key = (i * 7) % N / 2;
+        items[i].order = i;
+        STL_Intrusive_list_push_back(&a, &items[i].hook);
+    }
+    STL_Intrusive_list_sort(&a, keycmp);
+    ok = keys_are(&a, sorted, N);
+    for (hook = STL_Intrusive_list_begin(&a); hook->next != STL_Intrusive_list_end(&a); hook = hook->next) {
+        ok = ok && (keycmp(hook, hook->next) < 0 || STL_Intrusive_list_entry(hook, item, hook)->order <
+                                                     STL_Intrusive_list_entry(hook->next, item, hook)->order);
+    }
+    check(ok, "sort is stable");
+
+    STL_Intrusive_list_reverse(&a);
+    for (i = 0; i < N; ++i) {
+        model[i] = sorted[N - 1 - i];
+    }
+    check(keys_are(&a, model, N), "reverse");
+
+    STL_Intrusive_list_swap(&a, &b);
+    check(STL_Intrusive_list_empty(&a) && STL_Intrusive_list_size(&b) == N, "swap");
+
+    STL_Intrusive_list_clear(&b);
+    for (ok = 1, i = 0; i < N; ++i) {
+        ok = ok && !STL_Intrusive_list_is_linked(&items[i].hook);
+    }
+    check(ok && STL_Intrusive_list_empty(&b), "clear unlinks every hook");
+
+    /* Returning value */
+    return failed;
+}
@@ -0,0 +1,295 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+
+#include "../src/STL_Headers/STL/STL_List.h"
+#include "../src/STL_Headers/STL/__internal/__STL_Rank_tree.h"
+
+#define N 20000
+#define NLISTS 20000
+#define NSCATTERED 2000
+#define BIG 600
+#define NKEYS 50
+
+typedef struct record {
+    int key;
+    int order;
+} record;
+
+static int failed = 0;
+
+void check(int cond, const char *what) {
+
+    /* Main part */
+    printf("%s\t%s\n", cond ? "OK!" : "FAIL!", what);
+    if (!cond) {
+        ++failed;
+    }
+}
+
+long peak_kb(void) {
+
+    /* Initializing variables */
+    auto struct rusage usage;
+
+    /* Main part */
+    getrusage(RUSAGE_SELF, &usage);
+
+    /* Returning value */
+    return usage.ru_maxrss;
+}
+
+int intcmp(const void *a, const void *b) {
+
+    /* Returning value */
+    return *(const int *) a - *(const int *) b;
+}
+
+int keycmp(const void *a, const void *b) {
+
+    /* Returning value */
+    return ((const record *) a)->key - ((const record *) b)->key;
+}
+
+int holds(const void *elem, size_t size, int value) {
+
+    /* A large element is "value" followed by bytes equal to it */
+
+    /* Initializing variables */
+    auto const char *bytes = elem;
+    auto size_t i;
+
+    /* Main part */
+    if (*(const int *) elem != value) {
+        return 0;
+    }
+
+    for (i = sizeof(int); i < size; ++i) {
+        if (bytes[i] != (char) value) {
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return 1;
+}
+
+int matches(STL_List *l, const int *model, size_t n) {
+
+    /* Initializing variables */
+    auto STL_List_node *iter;
+    auto size_t i;
+
+    /* Main part */
+    if (STL_List_size(l) != n) {
+        return 0;
+    }
+
+    for (i = 0, iter = STL_List_begin(l); i < n; ++i, iter = iter->next) {
+        if (iter == STL_List_end(l) || *(int *) iter->value != model[i] || STL_List_node_at(l, i) != iter) {
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return iter == STL_List_end(l) && STL_List_node_at(l, n) == STL_List_end(l);
+}
+
+main() {
+
+    /* Initializing variables */
+    auto STL_List keep, batch, list;
+    auto STL_List_node *iter;
+    auto record rec, *a, *b;
+    auto long before;
+    auto int i, round, ok, value;
+    auto size_t n = 0, pos, height, nlarge;
+    static int model[N];
+    static STL_List small[NLISTS];
+    static STL_List_node *large[NSCATTERED];
+    static char big[BIG];
+
+    STL_List_init(&keep);
+    STL_List_init(&list);
+    srand(1);
+
+    /* Main part */
+    /* A list of a few elements takes a small slab, not a chunk of its own */
+    before = peak_kb();
+    for (i = 0; i < NLISTS; ++i) {
+        STL_List_init(small + i);
+        STL_List_push_back(small + i, &i, sizeof(int));
+    }
+    check(peak_kb() - before < 32 * 1024, "one-element lists stay small");
+
+    for (ok = 1, i = 0; i < NLISTS; ++i) {
+        ok = ok && *(int *) STL_List_front(small + i) == i;
+        STL_List_delete(small + i);
+    }
+    check(ok, "one-element lists keep their elements");
+
+    /* Positional access through the index, checked against an array */
+    check(STL_List_enable_index(&list) == STL_List_OK, "enable_index");
+    for (ok = 1, value = 0; n < N; ++value) {
+        pos = (size_t) rand() % (n + 1);
+        ok = ok && STL_List_insert_at(&list, &value, sizeof(int), pos) == STL_List_OK;
+        for (i = (int) n; i > (int) pos; --i) {
+            model[i] = model[i - 1];
+        }
+        model[pos] = value;
+        ++n;
+
+        pos = (size_t) rand() % n;
+        ok = ok && *(int *) STL_List_node_at(&list, pos)->value == model[pos];
+    }
+    height = list.index->height;
+    check(ok && height > 2 && !list.index->stale && matches(&list, model, n), "insert_at + node_at splitting tree nodes");
+
+    for (ok = 1; n > 10;) {
+        pos = (size_t) rand() % n;
+        iter = STL_List_erase_at(&list, pos);
+        for (i = (int) pos; i < (int) n - 1; ++i) {
+            model[i] = model[i + 1];
+        }
+        --n;
+        ok = ok && iter == STL_List_node_at(&list, pos) && (pos == n || *(int *) iter->value == model[pos]);
+    }
+    check(ok && list.index->height < height && !list.index->stale && matches(&list, model, n),
+          "erase_at + node_at collapsing the root");
+
+    /* Splicing and sorting leave the index stale, the next positional access rebuilds it */
+    STL_List_init(&batch);
+    for (i = 0; i < 1000; ++i) {
+        value = N + i;
+        STL_List_push_back(&batch, &value, sizeof(int));
+    }
+    STL_List_splice_node(&list, STL_List_node_at(&list, 5), &batch, STL_List_node_at(&batch, 500));
+    for (i = (int) n; i > 5; --i) {
+        model[i] = model[i - 1];
+    }
+    model[5] = N + 500;
+    ++n;
+    ok = list.index->stale;
+    check(ok && *(int *) STL_List_node_at(&list, 5)->value == N + 500 && !list.index->stale && matches(&list, model, n),
+          "index rebuilt after splice_node");
+
+    STL_List_splice(&list, STL_List_node_at(&list, 3), &batch);
+    for (i = (int) n - 1; i >= 3; --i) {
+        model[i + 999] = model[i];
+    }
+    for (i = 0; i < 999; ++i) {
+        model[3 + i] = N + i + (i >= 500);
+    }
+    n += 999;
+    ok = list.index->stale;
+    check(ok && matches(&list, model, n) && !list.index->stale, "index rebuilt after splice");
+
+    STL_List_sort(&list, -1, intcmp);
+    qsort(model, n, sizeof(int), intcmp);
+    ok = list.index->stale;
+    check(ok && matches(&list, model, n) && !list.index->stale, "index rebuilt after sort");
+
+    for (ok = 1; n > 0;) {
+        pos = (size_t) rand() % n;
+        STL_List_erase_at(&list, pos);
+        for (i = (int) pos; i < (int) n - 1; ++i) {
+            model[i] = model[i + 1];
+        }
+        --n;
+        ok = ok && (!n || *(int *) STL_List_node_at(&list, pos % n)->value == model[pos % n]);
+    }
+    check(ok && STL_List_empty(&list) && STL_List_node_at(&list, 0) == STL_List_end(&list), "erase_at down to empty");
+
+    STL_List_delete(&batch);
+    STL_List_delete(&list);
+
+    /* One node out of every batch outlives it: the rest of the batch has to be freed with it */
+    before = peak_kb();
+    for (round = 0; round < 1000; ++round) {
+        STL_List_init(&batch);
+        for (i = 0; i < 10000; ++i) {
+            STL_List_push_back(&batch, &i, sizeof(int));
+        }
+        STL_List_splice_node(&keep, STL_List_end(&keep), &batch, STL_List_end(&batch)->prev);
+        STL_List_delete(&batch);
+    }
+    check(peak_kb() - before < 64 * 1024, "splice_node + delete stays bounded");
+
+    ok = STL_List_size(&keep) == 1000;
+    for (iter = STL_List_begin(&keep); iter != STL_List_end(&keep); iter = iter->next) {
+        ok = ok && *(int *) iter->value == 9999;
+    }
+    check(ok, "spliced nodes outlive their list");
+
+    while (!STL_List_empty(&keep)) {
+        STL_List_pop_front(&keep);
+    }
+    check(STL_List_empty(&keep), "spliced nodes freed");
+
+    STL_List_delete(&keep);
+
+    /* Sorting relinks nodes all over their slabs, compacting lays them out again. Every 50th element is large */
+    STL_List_init(&list);
+    for (i = 0; i < NSCATTERED; ++i) {
+        model[i] = rand() % 1000;
+        if (i % 50 == 0) {
+            memset(big, (char) model[i], BIG);
+            memcpy(big, model + i, sizeof(int));
+            STL_List_push_back(&list, big, BIG);
+        } else {
+            STL_List_push_back(&list, model + i, sizeof(int));
+        }
+    }
+    STL_List_sort(&list, -1, intcmp);
+    qsort(model, NSCATTERED, sizeof(int), intcmp);
+
+    for (nlarge = 0, iter = STL_List_begin(&list); iter != STL_List_end(&list); iter = iter->next) {
+        if (iter->size == BIG) {
+            large[nlarge++] = iter;
+        }
+    }
+    check(nlarge == NSCATTERED / 50 && STL_List_fragmentation(&list) > 0.5, "sorted nodes are scattered");
+
+    check(STL_List_compact(&list) == STL_List_OK && STL_List_fragmentation(&list) == 0.0, "compact leaves no gaps");
+
+    for (ok = 1, n = 0, i = 0, iter = STL_List_begin(&list); iter != STL_List_end(&list); iter = iter->next, ++i) {
+        ok = ok && i < NSCATTERED && holds(iter->value, iter->size, model[i]);
+        if (iter->size == BIG) {
+            ok = ok && n < nlarge && iter == large[n++];
+        }
+    }
+    check(ok && i == NSCATTERED && STL_List_size(&list) == NSCATTERED, "compact keeps contents and order");
+    check(ok && n == nlarge, "large nodes survive compact where they are");
+
+    /* The compacted nodes go back to the pool like any others */
+    for (i = 0; i < NSCATTERED / 2; ++i) {
+        STL_List_pop_front(&list);
+        STL_List_push_back(&list, &i, sizeof(int));
+    }
+    check(STL_List_size(&list) == NSCATTERED && holds(STL_List_front(&list), sizeof(int), model[NSCATTERED / 2]),
+          "compacted nodes freed and reused");
+
+    STL_List_delete(&list);
+
+    /* Equal keys keep the order the records were made in */
+    STL_List_init(&list);
+    for (i = 0; i < NSCATTERED; ++i) {
+        rec.key = rand() % NKEYS;
+        rec.order = i;
+        STL_List_push_back(&list, &rec, sizeof(record));
+    }
+    STL_List_sort(&list, -1, keycmp);
+
+    for (ok = 1, iter = STL_List_begin(&list); iter->next != STL_List_end(&list); iter = iter->next) {
+        a = iter->value;
+        b = iter->next->value;
+        ok = ok && (a->key < b->key || (a->key == b->key && a->order < b->order)) && iter->next->prev == iter;
+    }
+    check(ok && STL_List_size(&list) == NSCATTERED, "sort is stable");
+
+    STL_List_delete(&list);
+
+    /* Returning value */
+    return failed;
+}
@@ -1,15 +1,40 @@
 #include <stdio.h>
+#include <sys/resource.h>
 
 #include "../src/STL_Headers/STL/STL_Stack.h"
 
+long peak_kb(void) {
+
+    /* Initializing variables */
+    auto struct rusage usage;
+
+    /* Main part */
+    getrusage(RUSAGE_SELF, &usage);
+
+    /* Returning value */
+    return usage.ru_maxrss;
+}
+
 main() {
 
     /* Initializing variables */
-    STL_Stack a;
+    STL_Stack a, b;
     STL_Stack_init(&a);
-    int i;
+    int i, values[3] = {10, 11, 12}, failed = 0;
+    long before;
 
     /* Main part */
+    /* Single pushes onto a list-backed stack take about what push_back onto a list does */
+    before = peak_kb();
+    for (i = 0; i < 200000; ++i) {
+        STL_Stack_push(&a, &i, sizeof(int));
+    }
+    failed = peak_kb() - before >= 32 * 1024 || STL_Stack_size(&a) != 200000 || *(int *) STL_Stack_top(&a) != 199999;
+    printf("%s\tsingle pushes stay small\n", (failed) ? "FAIL!" : "OK!");
+    STL_Stack_delete(&a);
+    STL_Stack_init(&a);
+
+    STL_Stack_reserve(&a, 10, sizeof(int));
     for (i = 0; i < 10; ++i) {
         STL_Stack_push(&a, &i, sizeof(int));
     }
@@ -21,7 +46,27 @@ main() {
     }
 
     STL_Stack_delete(&a);
+    printf("\n");
+
+    /* Vector-backed: starts in the inline block, then moves to the heap */
+    STL_Stack_init_vector(&a, sizeof(int));
+    for (i = 0; i < 100; ++i) {
+        STL_Stack_push(&a, &i, sizeof(int));
+    }
+    STL_Stack_pop_n(&a, 95);
+    STL_Stack_push_n(&a, values, 3, sizeof(int));
+
+    STL_Stack_init(&b);
+    STL_Stack_swap(&a, &b);
+    while (!STL_Stack_empty(&b)) {
+        i = *((int *) STL_Stack_top(&b));
+        printf("%d ", i);
+        STL_Stack_pop(&b);
+    }
+
+    STL_Stack_delete(&a);
+    STL_Stack_delete(&b);
 
     /* Returning value */
-    return 0;
+    return failed;
 }
\ No newline at end of file
@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "../src/STL_Headers/STL/STL_String.h"
+#include "../src/STL_Headers/STL/STL_String_view.h"
+#include "../src/STL_Headers/STL/STL_String_matcher.h"
+#include "../src/STL_Headers/STL/STL_String_reader.h"
+#include "../src/STL_Headers/STL/STL_String_map.h"
+#include "../src/STL_Headers/STL/STL_String_split.h"
+#include "../src/STL_Headers/STL/STL_String_table.h"
+
+static int failed = 0;
+
+void check(int cond, const char *what) {
+
+    /* Main part */
+    printf("%s\t%s\n", cond ? "OK!" : "FAIL!", what);
+    if (!cond) {
+        ++failed;
+    }
+}
+
+int count_match(size_t pattern, size_t pos, void *arg) {
+
+    /* Main part */
+    *(size_t *) arg += pattern * 100 + pos;
+
+    /* Returning value */
+    return 0;
+}
+
+main() {
+
+    /* Initializing variables */
+    auto STL_String a, b;
+    auto STL_String_view v;
+    auto STL_String_tokenizer tok;
+    auto STL_String_token token;
+    auto STL_Vector fields;
+    auto STL_String_reader reader;
+    auto int fds[2];
+    auto STL_String_matcher matcher;
+    auto STL_String_matcher_state state;
+    auto STL_String_table table, loaded;
+    auto STL_String_map map;
+    auto FILE *file;
+    auto size_t sum = 0, n;
+    auto double d;
+    auto long long ll;
+    auto char buf[16];
+
+    STL_String_init(&a);
+    STL_String_init(&b);
+
+    /* Main part */
+    STL_String_append_str(&a, "hello, world");
+    check(STL_String_size(&a) == 12 && !strcmp(STL_String_c_str(&a), "hello, world"), "append_str");
+
+    STL_String_insert_str(&a, 5, " there");
+    check(!strcmp(STL_String_c_str(&a), "hello there, world"), "insert_str");
+
+    STL_String_erase(&a, 5, 6);
+    check(!strcmp(STL_String_c_str(&a), "hello, world"), "erase");
+
+    STL_String_insert(&a, 0, '>', 2);
+    STL_String_pop_back(&a);
+    check(!strcmp(STL_String_c_str(&a), ">>hello, worl"), "insert and pop_back");
+
+    STL_String_replace(&a, 0, "<<<", 2);
+    check(!strcmp(STL_String_c_str(&a), "<<<hello, worl"), "replace with longer");
+    STL_String_replace(&a, 0, "", 3);
+    check(!strcmp(STL_String_c_str(&a), "hello, worl"), "replace with shorter");
+
+    check(STL_String_starts_with(&a, "hello") == 1 && STL_String_starts_with(&a, "world") == 0, "starts_with");
+    check(STL_String_ends_with(&a, "worl") == 1 && STL_String_ends_with(&a, "hello") == 0, "ends_with");
+    check(STL_String_find(&a, "o") == 4 && STL_String_rfind(&a, "o") == 8, "find and rfind");
+    check(STL_String_find_first_of(&a, " ,") == 5 && STL_String_find_last_not_of(&a, "lrw") == 8, "find_*_of");
+
+    /* Embedded zeros */
+    STL_String_append_str_n(&b, "ab\0cd\0ef", 8);
+    check(STL_String_size(&b) == 8, "append_str_n keeps zeros");
+    check(STL_String_find_n(&b, "\0ef", 3) == 5 && STL_String_rfind_n(&b, "\0", 1) == 5, "find_n over zeros");
+    check(STL_String_ends_with_n(&b, "d\0ef", 4) == 1 && STL_String_starts_with_n(&b, "ab\0c", 4) == 1,
+          "starts_with_n and ends_with_n over zeros");
+    STL_String_erase(&b, 2, 1);
+    check(STL_String_size(&b) == 7 && !memcmp(STL_String_data(&b), "abcd\0ef", 8), "erase over zeros");
+
+    /* Views */
+    v = STL_String_substr_view(&a, 7, 100);
+    check(STL_String_view_size(&v) == 4 && STL_String_view_data(&v) == STL_String_data(&a) + 7, "substr_view");
+    check(STL_String_view_copy(&v, buf, sizeof(buf), 0) == 4 && !memcmp(buf, "worl", 4), "view copy");
+
+    /* Hashing */
+    STL_String_clear(&b);
+    STL_String_append_str(&b, "hello, worl");
+    check(STL_String_hash(&a) == STL_String_hash(&b) && STL_String_equal(&a, &b), "hash and equal");
+    STL_String_push_back(&b, 'd');
+    check(STL_String_hash(&a) != STL_String_hash(&b) && !STL_String_equal(&a, &b), "hash invalidated on mutation");
+
+    /* Unicode */
+    STL_String_view_init_str(&v, "z\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+    check(STL_String_view_utf8_validate(&v) == STL_String_OK && STL_String_view_utf8_length(&v) == 4, "utf8 validate");
+    check(STL_String_utf8_to_utf16(&b, &v) == STL_String_OK && STL_String_size(&b) == 5 &&
+          ((unsigned short *) STL_String_data(&b))[3] == 0xD83D, "utf8 to utf16");
+    check(STL_String_utf16_to_utf8(&a, &b) == STL_String_OK && STL_String_size(&a) == 10 &&
+          !memcmp(STL_String_data(&a), STL_String_view_data(&v), 10), "utf16 to utf8");
+    STL_String_view_init_str(&v, "\xED\xA0\x80");
+    check(STL_String_view_utf8_validate(&v) == STL_String_encoding_error, "utf8 rejects surrogates");
+
+    STL_String_delete(&b);
+    STL_String_init(&b);
+    STL_String_append_str(&b, "x=");
+    check(STL_String_appendf(&b, "%d %u %x %s %.2f %e %g %5.1f|%c", -42, 7u, 255u, "str", 2.346, 1234.5, 0.0001,
+                             3.14159, '!') == STL_String_OK &&
+          !strcmp(STL_String_c_str(&b), "x=-42 7 ff str 2.35 1.234500e+03 0.0001   3.1|!"), "appendf");
+
+    STL_String_view_init_str(&v, "a,b,,c");
+    STL_Vector_init(&fields, sizeof(STL_String_token));
+    check(STL_String_split(&v, ",", 1, STL_String_split_char, 0, &fields) == STL_String_OK &&
+          STL_Vector_size(&fields) == 4 && ((STL_String_token *) STL_Vector_at(&fields, 3))->pos == 5, "split");
+    STL_Vector_delete(&fields);
+
+    STL_String_view_init_str(&v, "  key = value\t");
+    STL_String_tokenizer_init(&tok, &v, " =\t", 3, STL_String_split_any, 1);
+    check(STL_String_tokenizer_next(&tok, &token) && token.pos == 2 && token.nchar == 3 &&
+          STL_String_tokenizer_next(&tok, &token) && STL_String_tokenizer_view(&tok, &token).nchar == 5 &&
+          !STL_String_tokenizer_next(&tok, &token), "tokenizer");
+
+    if (pipe(fds) == 0) {
+        check(write(fds[1], "first\n\nlast", 12) == 12, "pipe write");
+        close(fds[1]);
+        STL_String_reader_init(&reader, fds[0], 4);
+        check(STL_String_reader_getline(&reader, &v) == STL_String_OK && v.nchar == 5 &&
+              !memcmp(v.data, "first", 5), "reader getline");
+        check(STL_String_reader_getline(&reader, &v) == STL_String_OK && v.nchar == 0, "reader empty line");
+        STL_String_clear(&b);
+        check(STL_String_reader_append_line(&reader, &b) == STL_String_OK &&
+              !strcmp(STL_String_c_str(&b), "last"), "reader append_line");
+        check(STL_String_reader_getline(&reader, &v) == STL_String_end_of_file, "reader end of file");
+        STL_String_reader_delete(&reader);
+        close(fds[0]);
+    }
+
+    STL_String_clear(&b);
+    STL_String_append_str(&b, "Content-Type: Text/HTML");
+    STL_String_to_lower(&b);
+    check(!strcmp(STL_String_c_str(&b), "content-type: text/html"), "to_lower");
+    check(STL_String_istarts_with(&b, "CONTENT-") && STL_String_ifind(&b, "TEXT/Html") == 14, "istarts_with and ifind");
+
+    STL_String_clear(&b);
+    STL_String_append_str(&b, "a-b-c-d");
+    check(STL_String_replace_all(&b, "-", "::") == STL_String_OK && !strcmp(STL_String_c_str(&b), "a::b::c::d") &&
+          STL_String_replace_first_n(&b, "::", "", 2) == STL_String_OK && !strcmp(STL_String_c_str(&b), "abc::d"),
+          "replace_all and replace_first_n");
+
+    STL_String_matcher_init(&matcher);
+    STL_String_matcher_add(&matcher, "he", 2);
+    STL_String_matcher_add(&matcher, "she", 3);
+    STL_String_matcher_add(&matcher, "hers", 4);
+    STL_String_matcher_compile(&matcher);
+    STL_String_matcher_state_init(&state);
+    STL_String_matcher_feed(&matcher, &state, "us", 2, count_match, &sum);
+    STL_String_matcher_feed(&matcher, &state, "hers", 4, count_match, &sum);
+    check(sum == (0 * 100 + 2) + (1 * 100 + 1) + (2 * 100 + 2), "matcher");
+    STL_String_matcher_delete(&matcher);
+
+    STL_String_view_init_str(&v, "-1.25e-3xyz");
+    check(STL_String_view_parse_double(&v, &d, &n) == STL_String_OK && d == -0.00125 && n == 8, "parse_double");
+    STL_String_view_init_str(&v, "9223372036854775808");
+    check(STL_String_view_parse_llong(&v, &ll, &n) == STL_String_range_error && n == 19, "parse_llong out of range");
+    STL_String_clear(&b);
+    STL_String_append_double(&b, 0.1);
+    STL_String_push_back(&b, ' ');
+    STL_String_append_double(&b, 1e23);
+    STL_String_push_back(&b, ' ');
+    STL_String_append_llong(&b, -42);
+    check(!strcmp(STL_String_c_str(&b), "0.1 1e+23 -42"), "append_double and append_llong");
+
+    STL_String_clear(&b);
+    STL_String_append_str(&b, "shared");
+    STL_String_delete(&a);
+    check(STL_String_share(&b) == STL_String_OK && STL_String_init_cpy(&a, &b) == STL_String_OK &&
+          STL_String_c_str(&a) == STL_String_c_str(&b), "init_cpy of a shared string");
+    STL_String_push_back(&a, '!');
+    check(STL_String_c_str(&a) != STL_String_c_str(&b) && !strcmp(STL_String_c_str(&a), "shared!") &&
+          !strcmp(STL_String_c_str(&b), "shared"), "write detaches a shared copy");
+
+    STL_String_table_init(&table);
+    STL_String_table_push_back(&table, "pear", 4);
+    STL_String_table_push_back(&table, "apple", 5);
+    STL_String_table_push_back(&table, "app", 3);
+    check(STL_String_table_sort(&table) == STL_String_OK && STL_String_table_at(&table, 0).nchar == 3 &&
+          STL_String_table_lower_bound(&table, "banana", 6) == 2, "table sort and lower_bound");
+    if (pipe(fds) == 0) {
+        STL_String_table_init(&loaded);
+        check(STL_String_table_save(&table, fds[1]) == STL_String_OK && STL_String_table_load(&loaded, fds[0]) == STL_String_OK &&
+              STL_String_table_size(&loaded) == 3 && !memcmp(STL_String_table_at(&loaded, 2).data, "pear", 4),
+              "table save and load");
+        STL_String_table_delete(&loaded);
+        close(fds[0]);
+        close(fds[1]);
+    }
+    STL_String_table_delete(&table);
+
+    if ((file = tmpfile()) != NULL) {
+        fputs("mapped file contents", file);
+        fflush(file);
+        check(STL_String_map_init(&map, fileno(file), 7, 100, STL_String_map_sequential) == STL_String_OK &&
+              (v = STL_String_map_view(&map)).nchar == 13 && STL_String_view_find(&v, "contents") == 5, "map a file region");
+        STL_String_map_delete(&map);
+        check(STL_String_map_init(&map, fileno(file), 0, 100, -1) == STL_String_index_error && map.addr == NULL,
+              "map with a bad advice");
+        fclose(file);
+    }
+
+    STL_String_resize(&a, 20);
+    check(STL_String_size(&a) == 20 && *STL_String_at(&a, 19) == '\0', "resize");
+
+    STL_String_delete(&a);
+    STL_String_delete(&b);
+
+    /* Returning value */
+    return failed;
+}
@@ -0,0 +1,173 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../src/STL_Headers/STL/STL_Unrolled_list.h"
+
+#define N 2000
+#define CAPACITY 8
+
+static int failed = 0;
+
+void check(int cond, const char *what) {
+
+    /* Main part */
+    printf("%s\t%s\n", cond ? "OK!" : "FAIL!", what);
+    if (!cond) {
+        ++failed;
+    }
+}
+
+int matches(STL_Unrolled_list *l, const int *model, size_t n) {
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_iterator iter;
+    auto size_t i;
+
+    /* Main part */
+    if (STL_Unrolled_list_size(l) != n) {
+        return 0;
+    }
+
+    for (i = 0, iter = STL_Unrolled_list_begin(l); iter.node != NULL; STL_Unrolled_list_next(&iter), ++i) {
+        if (i == n || *(int *) STL_Unrolled_list_get(l, iter) != model[i] ||
+            *(int *) STL_Unrolled_list_at(l, i) != model[i]) {
+            return 0;
+        }
+    }
+
+    if (i != n) {
+        return 0;
+    }
+
+    for (iter = STL_Unrolled_list_end(l); i > 0;) {
+        STL_Unrolled_list_prev(l, &iter);
+        if (iter.node == NULL || *(int *) STL_Unrolled_list_get(l, iter) != model[--i]) {
+            return 0;
+        }
+    }
+
+    /* Returning value */
+    return 1;
+}
+
+int half_full(STL_Unrolled_list *l) {
+
+    /* Initializing variables */
+    auto STL_Unrolled_list_node *node;
+    auto size_t n = 0;
+
+    /* Main part */
+    for (node = l->head; node != NULL; node = node->next) {
+        if (node->nelem > l->node_capacity || (node != l->tail && 2 * node->nelem < l->node_capacity) ||
+            (node->next != NULL && node->next->prev != node)) {
+            return 0;
+        }
+        n += node->nelem;
+    }
+
+    /* Returning value */
+    return n == l->nelem;
+}
+
+main() {
+
+    /* Initializing variables */
+    auto STL_Unrolled_list list, copy;
+    auto STL_Unrolled_list_iterator iter;
+    auto int i, ok = 1, shape = 1, value = 0;
+    auto size_t n = 0, pos, j;
+    static int model[N];
+
+    STL_Unrolled_list_init(&list, sizeof(int), CAPACITY);
+    srand(1);
+
+    /* Main part */
+    /* Random inserts and erases at iterators, checked against an array. They split and merge nodes all the time */
+    for (i = 0; i < 20000; ++i) {
+        if (n < N && (n == 0 || rand() % 100 < ((i < 10000) ? 60 : 40))) {
+            pos = (size_t) rand() % (n + 1);
+            iter = STL_Unrolled_list_iterator_at(&list, pos);
+            ok = ok && STL_Unrolled_list_insert(&list, &iter, &value) == STL_Unrolled_list_OK &&
+                 *(int *) STL_Unrolled_list_get(&list, iter) == value;
+            for (j = n; j > pos; --j) {
+                model[j] = model[j - 1];
+            }
+            model[pos] = value++;
+            ++n;
+        } else {
+            pos = (size_t) rand() % n;
+            iter = STL_Unrolled_list_iterator_at(&list, pos);
+            ok = ok && STL_Unrolled_list_erase(&list, &iter) == STL_Unrolled_list_OK;
+            for (j = pos; j + 1 < n; ++j) {
+                model[j] = model[j + 1];
+            }
+            --n;
+            ok = ok && ((pos == n) ? iter.node == NULL : *(int *) STL_Unrolled_list_get(&list, iter) == model[pos]);
+        }
+        shape = shape && half_full(&list);
+        if (i % 100 == 0) {
+            ok = ok && matches(&list, model, n);
+        }
+    }
+    check(ok && matches(&list, model, n), "insert + erase at iterators");
+    check(shape, "nodes but the last one stay at least half full");
+
+    /* Both ends */
+    for (ok = 1, shape = 1, i = 0; i < 1000; ++i) {
+        if (i % 3 == 0 && n > 0) {
+            if (i % 2) {
+                STL_Unrolled_list_pop_front(&list);
+                for (j = 0; j + 1 < n; ++j) {
+                    model[j] = model[j + 1];
+                }
+            } else {
+                STL_Unrolled_list_pop_back(&list);
+            }
+            --n;
+        } else if (n < N) {
+            if (i % 2) {
+                STL_Unrolled_list_push_front(&list, &value);
+                for (j = n; j > 0; --j) {
+                    model[j] = model[j - 1];
+                }
+                model[0] = value++;
+            } else {
+                STL_Unrolled_list_push_back(&list, &value);
+                model[n] = value++;
+            }
+            ++n;
+        }
+        shape = shape && half_full(&list);
+    }
+    check(matches(&list, model, n) && shape, "push + pop at both ends");
+
+    STL_Unrolled_list_init_cpy(&copy, &list);
+    check(matches(&copy, model, n) && half_full(&copy), "init_cpy");
+
+    /* Down to empty from the front, the middle and the back */
+    for (ok = 1, shape = 1; n > 0;) {
+        pos = (n % 3 == 0) ? 0 : (n % 3 == 1) ? n / 2 : n - 1;
+        iter = STL_Unrolled_list_iterator_at(&list, pos);
+        STL_Unrolled_list_erase(&list, &iter);
+        for (j = pos; j + 1 < n; ++j) {
+            model[j] = model[j + 1];
+        }
+        --n;
+        shape = shape && half_full(&list);
+        if (n % 50 == 0) {
+            ok = ok && matches(&list, model, n);
+        }
+    }
+    check(ok && shape && STL_Unrolled_list_empty(&list) && list.head == NULL, "erase down to empty");
+
+    iter = STL_Unrolled_list_end(&list);
+    check(STL_Unrolled_list_insert(&list, &iter, &value) == STL_Unrolled_list_OK &&
+              *(int *) STL_Unrolled_list_front(&list) == value && STL_Unrolled_list_size(&list) == 1,
+          "insert at the end of an empty list");
+
+    STL_Unrolled_list_delete(&copy);
+    STL_Unrolled_list_delete(&list);
+
+    /* Returning value */
+    return failed;
+}